@@ -0,0 +1,47 @@
+/*----------------------------------------------------------------------------------------------------------
+ * MutantFMSynthHost.cpp
+ * 
+ * Compiles the main sketch for the native (Linux) build.
+ * 
+ * PlatformIO only converts .ino files for Arduino targets, so on the host the sketch is included 
+ * directly.  Host tools drive it through setup() and the Mozzi hooks in MozziHost.h
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include "MutantFMSynth.ino"
+#include "MozziHost.h"
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * hostSetKnobs
+ * sets all analog inputs and applies them to both voices through the sketch's own knob handling
+ * 
+ * updateAnalogControls() smooths each reading with the previous two and only acts on movements larger
+ * than ANALOG_INPUT_MOVEMENT_THRESHOLD, so the history is primed to make the smoothed value land exactly 
+ * on the new reading and register as a change
+ *----------------------------------------------------------------------------------------------------------
+ */
+void hostSetKnobs(const int* knobValues)
+{
+  byte lastControlSynthVoice = controlSynthVoice;
+
+  for (uint8_t voice = 0; voice < MAX_SEQUENCER_TRACKS; voice++)
+  {
+    controlSynthVoice = voice;
+
+    for (uint8_t i = 0; i < MAX_ANALOG_INPUTS; i++)
+    {
+      hostSetAnalogInput(A0 + i, knobValues[i]);
+      iCurrentAnalogValue[i] = knobValues[i] + 100;
+      iLastAnalogValue[i]    = knobValues[i] - 100;
+    }
+    updateAnalogControls();
+  }
+
+  controlSynthVoice = lastControlSynthVoice;
+}
@@ -0,0 +1,37 @@
+/*----------------------------------------------------------------------------------------------------------
+ * MutantFMSynthHost.h
+ * 
+ * Declares the sketch objects & functions used by the host tools
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef MUTANTFMSYNTHHOST_H
+#define MUTANTFMSYNTHHOST_H
+
+#include "avSource.h"
+#include "avSequencerMultiTrack.h"
+#include "LedMatrix.h"
+#include "MozziHost.h"
+
+extern MutatingFM                   voice0;
+extern MutatingFM                   voice1;
+extern MutatingSequencerMultiTrack  sequencer;
+extern LedMatrix                    ledDisplay;
+
+void setup();
+void loop();
+void updateControl();
+int  updateAudio();
+void startStopSequencer();
+#ifdef ENABLE_VOICE_MIX_MODES
+void setVoiceMixMode(uint8_t mode);
+#endif
+
+// sets all 8 analog inputs (0-1023, indexed from A0) and applies them to both voices
+void hostSetKnobs(const int* knobValues);
+
+#endif
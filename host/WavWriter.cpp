@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------------------------------------
+ * WavWriter.cpp
+ * 
+ * Writes mono 16-bit PCM WAV files for the host tools
+ * the header is written with a zero length on open() and patched with the real length on close()
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include "WavWriter.h"
+
+#define WAV_HEADER_BYTES 44
+
+
+// WAV fields are little-endian regardless of the host
+static void writeU32(FILE* f, uint32_t value)
+{
+  for (uint8_t i = 0; i < 4; i++) fputc((value >> (8 * i)) & 0xFF, f);
+}
+
+static void writeU16(FILE* f, uint16_t value)
+{
+  fputc(value & 0xFF, f);
+  fputc(value >> 8, f);
+}
+
+
+WavWriter::WavWriter()
+{
+  file        = NULL;
+  sampleRate  = 0;
+  sampleCount = 0;
+}
+
+
+WavWriter::~WavWriter()
+{
+  close();
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * WavWriter::open()
+ * creates the file and writes a placeholder header.  returns false if the file can't be created
+ *----------------------------------------------------------------------------------------------------------
+ */
+bool WavWriter::open(const char* fileName, uint32_t newSampleRate)
+{
+  close();
+
+  file        = fopen(fileName, "wb");
+  sampleRate  = newSampleRate;
+  sampleCount = 0;
+
+  if (file)
+  {
+    writeHeader();
+  }
+  return file != NULL;
+}
+
+
+void WavWriter::write(int16_t sample)
+{
+  if (file)
+  {
+    writeU16(file, (uint16_t)sample);
+    sampleCount++;
+  }
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * WavWriter::close()
+ * rewrites the header with the final length and closes the file
+ *----------------------------------------------------------------------------------------------------------
+ */
+bool WavWriter::close()
+{
+  bool ok = true;
+
+  if (file)
+  {
+    fseek(file, 0, SEEK_SET);
+    writeHeader();
+    ok    = (fclose(file) == 0);
+    file  = NULL;
+  }
+  return ok;
+}
+
+
+void WavWriter::writeHeader()
+{
+  uint32_t dataBytes = sampleCount * 2;
+
+  fwrite("RIFF", 1, 4, file);
+  writeU32(file, WAV_HEADER_BYTES - 8 + dataBytes);
+  fwrite("WAVE", 1, 4, file);
+
+  fwrite("fmt ", 1, 4, file);
+  writeU32(file, 16);             // fmt chunk size
+  writeU16(file, 1);              // PCM
+  writeU16(file, 1);              // mono
+  writeU32(file, sampleRate);
+  writeU32(file, sampleRate * 2); // byte rate
+  writeU16(file, 2);              // block align
+  writeU16(file, 16);             // bits per sample
+
+  fwrite("data", 1, 4, file);
+  writeU32(file, dataBytes);
+}
@@ -0,0 +1,36 @@
+/*----------------------------------------------------------------------------------------------------------
+ * WavWriter.h
+ * 
+ * Writes mono 16-bit PCM WAV files for the host tools
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef WavWriter_h
+#define WavWriter_h
+
+#include <stdio.h>
+#include <stdint.h>
+
+class WavWriter
+{
+  public:
+    WavWriter();
+    ~WavWriter();
+
+    bool open(const char* fileName, uint32_t sampleRate);
+    void write(int16_t sample);
+    bool close();
+
+  private:
+    void writeHeader();
+
+    FILE*     file;
+    uint32_t  sampleRate;
+    uint32_t  sampleCount;
+};
+
+#endif
@@ -0,0 +1,49 @@
+#!/bin/sh
+#----------------------------------------------------------------------------------------------------------
+# aliasingCompare.sh
+#
+# builds the aliasing measurement (host/aliasingMeasure.cpp) with the plain and the band-limited tables and
+# prints the band-limited table with the change in dB after each figure, eg "-40.1 (-26.2)"
+#
+# usage:  host/aliasingCompare.sh [ENV] [REFERENCE_ENV]
+#    ENV            build to check (default aliasing_measure_bandlimited), or aliasing_measure_interp512 or
+#                   aliasing_measure_interp256 for the interpolated tables
+#    REFERENCE_ENV  build to compare against (default aliasing_measure, the 2048-cell tables)
+#----------------------------------------------------------------------------------------------------------
+set -e
+cd "$(dirname "$0")/.."
+
+testEnv="${1:-aliasing_measure_bandlimited}"
+referenceEnv="${2:-aliasing_measure}"
+outputDir=".pio/aliasingCompare"
+
+pio run -s -e "$referenceEnv"
+pio run -s -e "$testEnv"
+mkdir -p "$outputDir"
+
+.pio/build/"$referenceEnv"/program > "$outputDir/$referenceEnv.md"
+.pio/build/"$testEnv"/program      > "$outputDir/$testEnv.md"
+
+awk -F'|' '
+  # first file:  remember each row by note
+  FNR == NR {
+    if ($2 ~ /[0-9]/) for (i = 4; i < NF; i++) before[$2, i] = $i
+    next
+  }
+
+  $0 ~ /^## / { print $0 " - change from " referenceEnv; next }
+
+  $2 ~ /[0-9]/ && ($2, 4) in before {
+    line = "|" $2 "|" $3 "|"
+    for (i = 4; i < NF; i++)
+    {
+      cell = $i
+      sub(/ +$/, "", cell)
+      line = line cell sprintf(" (%+.1f) |", $i - before[$2, i])
+    }
+    print line
+    next
+  }
+
+  { print }
+' referenceEnv="$referenceEnv" "$outputDir/$referenceEnv.md" "$outputDir/$testEnv.md"
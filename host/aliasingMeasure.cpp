@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------------------------------------
+ * aliasingMeasure.cpp
+ *
+ * Aliasing of the carrier waveforms across the note range, for ENABLE_BANDLIMITED_WAVETABLES
+ *
+ * Plays one FM voice with the modulator off, so the output is the bare carrier, for the sine, saw, reverse
+ * saw and square at octaves from MIDI note 36 to 108 (track 1 can be 3 octaves above the sequence).  Each
+ * render is Hann windowed and run through an FFT, and the energy in bins near a harmonic of the note is
+ * counted as signal and everything else as aliasing.  Prints the aliasing relative to the signal in dB,
+ * lower is better.  The sine shows the floor from the 8 bit tables & the envelope.
+ *
+ * Build it as env:aliasing_measure and env:aliasing_measure_bandlimited and compare the two tables with
+ * aliasingCompare.sh
+ *
+ * usage:  program
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "avSource.h"
+#include "midinotephaseinc_uint32.h"
+
+#define FFT_BITS          14
+#define FFT_SIZE          (1 << FFT_BITS)
+#define SETTLE_SAMPLES    2048
+#define FIRST_NOTE        36
+#define LAST_NOTE         108
+#define HARMONIC_BINS     4
+#define DC_BINS           4
+#define NOTE_LENGTH       60000
+
+static const uint8_t  measuredWaveforms[]  = {WAVEFORM_SIN, WAVEFORM_SAW, WAVEFORM_REVSAW, WAVEFORM_SQUARE};
+static const char*    waveformNames[]      = {"sin", "saw", "revsaw", "square"};
+
+static double real[FFT_SIZE];
+static double imaginary[FFT_SIZE];
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * fft
+ * in-place radix-2 FFT of real[] & imaginary[]
+ *----------------------------------------------------------------------------------------------------------
+ */
+static void fft()
+{
+  for (uint32_t i = 1, j = 0; i < FFT_SIZE; i++)
+  {
+    uint32_t bit = FFT_SIZE >> 1;
+
+    for (; j & bit; bit >>= 1)
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+
+    if (i < j)
+    {
+      double swap;
+      swap = real[i];       real[i] = real[j];            real[j] = swap;
+      swap = imaginary[i];  imaginary[i] = imaginary[j];  imaginary[j] = swap;
+    }
+  }
+
+  for (uint32_t length = 2; length <= FFT_SIZE; length <<= 1)
+  {
+    double angle = -2.0 * M_PI / length;
+
+    for (uint32_t start = 0; start < FFT_SIZE; start += length)
+    {
+      for (uint32_t k = 0; k < length / 2; k++)
+      {
+        double    wr = cos(angle * k);
+        double    wi = sin(angle * k);
+        uint32_t  a  = start + k;
+        uint32_t  b  = a + length / 2;
+        double    tr = real[b] * wr - imaginary[b] * wi;
+        double    ti = real[b] * wi + imaginary[b] * wr;
+
+        real[b]      = real[a] - tr;
+        imaginary[b] = imaginary[a] - ti;
+        real[a]      += tr;
+        imaginary[a] += ti;
+      }
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * render
+ * plays the note on the voice and fills real[] with FFT_SIZE windowed samples after it has settled
+ *----------------------------------------------------------------------------------------------------------
+ */
+static void render(MutatingFM& voice, uint8_t note)
+{
+  voice.noteOn(note, 255, NOTE_LENGTH);
+
+  for (uint32_t i = 0; i < SETTLE_SAMPLES + FFT_SIZE; i++)
+  {
+    if ((i & ((1 << AUDIO_RAMP_SHIFT) - 1)) == 0)
+    {
+      voice.updateControl();
+    }
+
+    int sample = voice.updateAudio();
+
+    if (i >= SETTLE_SAMPLES)
+    {
+      uint32_t n = i - SETTLE_SAMPLES;
+
+      real[n]      = sample * (0.5 - 0.5 * cos(2.0 * M_PI * n / FFT_SIZE));
+      imaginary[n] = 0;
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * measureAliasing
+ * returns the energy away from the harmonics of the note relative to the energy on them, in dB
+ * the FFT is one second long so bin n is n Hz
+ *----------------------------------------------------------------------------------------------------------
+ */
+static double measureAliasing(double fundamental)
+{
+  double signal  = 0;
+  double alias   = 0;
+
+  fft();
+
+  for (uint32_t bin = DC_BINS; bin < FFT_SIZE / 2; bin++)
+  {
+    double power    = real[bin] * real[bin] + imaginary[bin] * imaginary[bin];
+    double harmonic = floor(bin / fundamental + 0.5) * fundamental;
+
+    if (harmonic > 0 && fabs(bin - harmonic) <= HARMONIC_BINS)
+    {
+      signal += power;
+    }
+    else
+    {
+      alias += power;
+    }
+  }
+
+  return 10.0 * log10(alias / signal);
+}
+
+
+int main(int argc, char** argv)
+{
+  MutatingFM voice;
+
+  // modulator off:  only the carrier is heard
+  while (voice.getModulatorWaveform() != WAVEFORM_NULL)
+  {
+    voice.toggleModulatorWaveform();
+  }
+  voice.setParam(SYNTH_PARAMETER_MOD_AMOUNT, 0);
+  voice.setParam(SYNTH_PARAMETER_MOD_AMOUNT_LFODEPTH, 0);
+
+  #ifdef ENABLE_BANDLIMITED_WAVETABLES
+  printf("## aliasing relative to the harmonics (dB) - band-limited %d-cell tables\n\n", WAVETABLE_NUM_CELLS);
+  #else
+  printf("## aliasing relative to the harmonics (dB) - %d-cell tables\n\n", WAVETABLE_NUM_CELLS);
+  #endif
+
+  printf("| note | Hz |");
+  for (uint8_t w = 0; w < sizeof(measuredWaveforms); w++)
+  {
+    printf(" %s |", waveformNames[w]);
+  }
+  printf("\n|------|------|------|------|------|------|\n");
+
+  for (uint8_t note = FIRST_NOTE; note <= LAST_NOTE; note += 12)
+  {
+    double fundamental = MIDINOTE_PHASEINC_DATA[note] / 8192.0;
+
+    printf("| %4u | %6.1f |", note, fundamental);
+    for (uint8_t w = 0; w < sizeof(measuredWaveforms); w++)
+    {
+      while (voice.getCarrierWaveform() != measuredWaveforms[w])
+      {
+        voice.toggleCarrierWaveform();
+      }
+
+      render(voice, note);
+      printf(" %6.1f |", measureAliasing(fundamental));
+    }
+    printf("\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,40 @@
+#!/bin/sh
+#----------------------------------------------------------------------------------------------------------
+# avrCycleBench.sh
+#
+# builds the AVR benchmark firmware and the simavr harness, then prints the cycle table for the current
+# commit.  needs PlatformIO, the Mozzi library (see readme) and simavr (eg apt install libsimavr-dev libelf-dev)
+#
+# usage:  host/bench/avrCycleBench.sh [output.md] [firmware env]
+#    firmware env defaults to bench_avr.  bench_avr_interp256 benchmarks the 256-cell interpolated wavetables
+#----------------------------------------------------------------------------------------------------------
+set -e
+cd "$(dirname "$0")/../.."
+
+firmwareEnv="${2:-bench_avr}"
+
+label="$(git rev-parse --short HEAD 2>/dev/null || echo local)"
+if ! git diff --quiet HEAD -- src 2>/dev/null; then
+  label="$label (modified)"
+fi
+if [ "$firmwareEnv" != "bench_avr" ]; then
+  label="$label $firmwareEnv"
+fi
+
+if ! command -v pio > /dev/null 2>&1; then
+  echo "PlatformIO (pio) isn't installed - see readme" >&2
+  exit 1
+fi
+
+pio run -s -e "$firmwareEnv"
+if ! pio run -s -e bench_sim; then
+  echo "couldn't build the simavr harness - is simavr installed? (eg apt install libsimavr-dev libelf-dev)" >&2
+  exit 1
+fi
+
+if [ -n "$1" ]; then
+  .pio/build/bench_sim/program .pio/build/"$firmwareEnv"/firmware.elf "$label" > "$1"
+  echo "wrote $1"
+else
+  .pio/build/bench_sim/program .pio/build/"$firmwareEnv"/firmware.elf "$label"
+fi
@@ -0,0 +1,64 @@
+#!/bin/sh
+#----------------------------------------------------------------------------------------------------------
+# cycleDiff.sh
+#
+# compares two cycle tables saved by avrCycleBench.sh and prints the new table with the change in cycles 
+# after each figure, eg "412 (-630)".  rows are matched on FM mode & waveforms
+#
+# usage:  host/bench/cycleDiff.sh before.md after.md
+#    eg   git stash; host/bench/avrCycleBench.sh before.md; git stash pop; host/bench/avrCycleBench.sh after.md
+#----------------------------------------------------------------------------------------------------------
+set -e
+
+if [ $# -ne 2 ]; then
+  echo "usage: $0 before.md after.md" >&2
+  exit 1
+fi
+
+awk -F'|' '
+  # splits a cell into its numbers, eg " 120-140 " or " 24.6% "
+  function numbers(cell, values,    n)
+  {
+    gsub(/[^0-9.]+/, " ", cell)
+    return split(cell, values, " ")
+  }
+
+  function key()
+  {
+    return $2 "|" $3 "|" $4
+  }
+
+  # first file:  remember every cell of each table row
+  FNR == NR {
+    if ($0 ~ /^\| / && NF > 5)
+    {
+      for (i = 5; i < NF; i++) before[key(), i] = $i
+    }
+    next
+  }
+
+  # second file:  print it, adding the differences to rows found in the first
+  $0 ~ /^## / { print $0 " - change from " beforeFile; next }
+
+  $0 ~ /^\| / && $5 ~ /[0-9]/ && (key(), 5) in before {
+    line = "|" $2 "|" $3 "|" $4 "|"
+    for (i = 5; i < NF; i++)
+    {
+      n = numbers($i, after)
+      numbers(before[key(), i], old)
+      change = ""
+      for (j = 1; j <= n; j++)
+      {
+        d = after[j] - old[j]
+        change = change (j > 1 ? "/" : "") (d > 0 ? "+" : "") d
+      }
+      cell = $i
+      sub(/ +$/, "", cell)
+      line = line cell " (" change ") |"
+    }
+    print line
+    next
+  }
+
+  { print }
+' beforeFile="$1" "$1" "$2"
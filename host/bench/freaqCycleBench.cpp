@@ -0,0 +1,188 @@
+/*----------------------------------------------------------------------------------------------------------
+ * freaqCycleBench.cpp
+ *
+ * simavr harness for the AVR benchmark firmware (freaqCycleBenchFirmware.cpp)
+ *
+ * Runs the firmware on a simulated 16MHz ATmega328P, traps the GPIOR0 markers and prints a markdown
+ * table of exact cycle counts per call for every FM mode and carrier/modulator waveform, with the
+ * two-voice audio path as a percentage of the per-sample budget (16MHz / AUDIO_RATE = 976 cycles).
+ * Compare two saved tables with cycleDiff.sh
+ *
+ * usage:  program firmware.elf [label]
+ *    label is printed in the table heading - avrCycleBench.sh passes the git commit
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+
+#include "freaqCycleBench.h"
+
+#define BENCH_AUDIO_RATE      16384
+#define BENCH_CYCLES_PER_SAMPLE (BENCH_CPU_FREQUENCY / BENCH_AUDIO_RATE)
+
+static const char* fmModeNames[]    = {"exponential", "linear high", "linear low", "free"};
+static const char* waveformNames6[] = {"sin", "saw", "revsaw", "square", "noise", "off"};
+static const char* waveformNames5[] = {"sin", "saw", "revsaw", "square", "off"};
+
+
+struct RegionStats
+{
+  uint64_t  min;
+  uint64_t  max;
+  uint64_t  total;
+  uint32_t  count;
+};
+
+static RegionStats        stats[MAX_BENCH_REGIONS];
+static avr_cycle_count_t  regionStart[MAX_BENCH_REGIONS];
+static uint64_t           calibration     = 0;
+static const char**       waveformNames   = waveformNames6;
+static bool               finished        = false;
+
+
+static void resetStats()
+{
+  for (uint8_t i = 0; i < MAX_BENCH_REGIONS; i++)
+  {
+    stats[i].min    = UINT64_MAX;
+    stats[i].max    = 0;
+    stats[i].total  = 0;
+    stats[i].count  = 0;
+  }
+}
+
+
+static uint64_t mean(uint8_t region)
+{
+  return stats[region].count ? (stats[region].total + stats[region].count / 2) / stats[region].count : 0;
+}
+
+
+static void printRow(uint8_t fmMode, uint8_t waveforms)
+{
+  RegionStats& mix = stats[BENCH_REGION_MIX_AUDIO];
+
+  printf("| %-11s | %-6s | %-9s | %6llu | %6llu | %6llu | %4llu-%-4llu | %4llu-%-4llu | %5.1f%% |\n",
+         fmModeNames[fmMode % 4],
+         waveformNames[waveforms >> 4],
+         waveformNames[waveforms & 0x0F],
+         (unsigned long long)mean(BENCH_REGION_NOTE_ON),
+         (unsigned long long)stats[BENCH_REGION_NOTE_ON_PAIR].max,
+         (unsigned long long)mean(BENCH_REGION_CONTROL),
+         (unsigned long long)stats[BENCH_REGION_VOICE_AUDIO].min, (unsigned long long)stats[BENCH_REGION_VOICE_AUDIO].max,
+         (unsigned long long)mix.min, (unsigned long long)mix.max,
+         100.0 * mix.max / BENCH_CYCLES_PER_SAMPLE);
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * onMarker
+ * called by simavr when the firmware writes GPIOR0
+ *----------------------------------------------------------------------------------------------------------
+ */
+static void onMarker(avr_t* avr, avr_io_addr_t addr, uint8_t value, void* param)
+{
+  avr->data[addr] = value;
+
+  if (BENCH_MARK_IS_START(value))
+  {
+    regionStart[BENCH_MARK_REGION(value)] = avr->cycle;
+  }
+  else if (BENCH_MARK_IS_END(value))
+  {
+    uint8_t   region  = BENCH_MARK_REGION(value);
+    uint64_t  cycles  = avr->cycle - regionStart[region];
+
+    if (region == BENCH_REGION_CALIBRATE)
+    {
+      calibration = cycles;
+    }
+    else if (region < MAX_BENCH_REGIONS)
+    {
+      cycles -= calibration;
+      if (cycles < stats[region].min) stats[region].min = cycles;
+      if (cycles > stats[region].max) stats[region].max = cycles;
+      stats[region].total += cycles;
+      stats[region].count++;
+    }
+  }
+  else if (value == BENCH_MARK_INFO)
+  {
+    waveformNames = (avr->data[BENCH_IO_CONFIG_A] == 5) ? waveformNames5 : waveformNames6;
+  }
+  else if (value == BENCH_MARK_ROW_END)
+  {
+    printRow(avr->data[BENCH_IO_CONFIG_A], avr->data[BENCH_IO_CONFIG_B]);
+    resetStats();
+  }
+  else if (value == BENCH_MARK_DONE)
+  {
+    finished = true;
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  elf_firmware_t  firmware;
+  avr_t*          avr;
+  int             state = cpu_Running;
+
+  if (argc < 2)
+  {
+    fprintf(stderr, "usage: %s firmware.elf [label]\n", argv[0]);
+    return 1;
+  }
+
+  memset(&firmware, 0, sizeof(firmware));
+  if (elf_read_firmware(argv[1], &firmware) != 0)
+  {
+    fprintf(stderr, "can't read %s\n", argv[1]);
+    return 1;
+  }
+
+  avr = avr_make_mcu_by_name("atmega328p");
+  if (!avr)
+  {
+    fprintf(stderr, "simavr has no atmega328p core\n");
+    return 1;
+  }
+
+  avr_init(avr);
+  avr_load_firmware(avr, &firmware);
+  avr->frequency = BENCH_CPU_FREQUENCY;
+  avr->log       = LOG_ERROR;
+
+  avr_register_io_write(avr, BENCH_IO_MARKER, onMarker, NULL);
+  resetStats();
+
+  printf("## AVR cycles per call%s%s\n\n", argc > 2 ? " - " : "", argc > 2 ? argv[2] : "");
+  printf("budget: %lu cycles per sample at %d Hz\n\n", BENCH_CYCLES_PER_SAMPLE, BENCH_AUDIO_RATE);
+  printf("| FM mode     | carrier | modulator | noteOn | 2-voice noteOn max | updateControl | voice updateAudio | 2-voice updateAudio | of budget |\n");
+  printf("|-------------|--------|-----------|--------|--------|--------|-----------|-----------|--------|\n");
+
+  while (!finished && state != cpu_Done && state != cpu_Crashed)
+  {
+    state = avr_run(avr);
+  }
+
+  if (!finished)
+  {
+    fprintf(stderr, "firmware stopped before the benchmark completed (state %d)\n", state);
+    return 1;
+  }
+
+  printf("\ncalibration overhead %llu cycles subtracted from each measurement\n", (unsigned long long)calibration);
+
+  avr_terminate(avr);
+  return 0;
+}
@@ -0,0 +1,50 @@
+/*----------------------------------------------------------------------------------------------------------
+ * freaqCycleBench.h
+ * 
+ * Marker protocol shared by the AVR benchmark firmware and the simavr harness
+ * 
+ * The firmware brackets each measured call with writes to GPIOR0, which the harness traps to read the 
+ * simulator's cycle counter.  GPIOR1 & GPIOR2 carry the settings under test so the harness can label rows.
+ * The kernel check firmware uses the same registers to send its audio samples.
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef freaqCycleBench_h
+#define freaqCycleBench_h
+
+// data-space addresses of the ATmega328P general purpose I/O registers
+#define BENCH_IO_MARKER       0x3E    // GPIOR0
+#define BENCH_IO_CONFIG_A     0x4A    // GPIOR1
+#define BENCH_IO_CONFIG_B     0x4B    // GPIOR2
+
+// measured regions
+#define BENCH_REGION_CALIBRATE    0   // empty region, subtracted from all others
+#define BENCH_REGION_NOTE_ON      1   // MutatingFM::noteOn() - includes setFreqs()
+#define BENCH_REGION_CONTROL      2   // MutatingFM::updateControl()
+#define BENCH_REGION_VOICE_AUDIO  3   // MutatingFM::updateAudio()
+#define BENCH_REGION_MIX_AUDIO    4   // updateAudio() in MutantFMSynth.ino - both voices plus the mix
+#define BENCH_REGION_NOTE_ON_PAIR 5   // noteOn() on both voices, as on a step where both tracks play
+#define MAX_BENCH_REGIONS         6
+
+#define BENCH_MARK_START(region)  (0x10 | (region))
+#define BENCH_MARK_END(region)    (0x20 | (region))
+#define BENCH_MARK_IS_START(mark) (((mark) & 0xF0) == 0x10)
+#define BENCH_MARK_IS_END(mark)   (((mark) & 0xF0) == 0x20)
+#define BENCH_MARK_REGION(mark)   ((mark) & 0x0F)
+
+#define BENCH_MARK_INFO           0x40    // CONFIG_A = number of waveforms in this build
+#define BENCH_MARK_ROW_END        0x41    // CONFIG_A = FM mode, CONFIG_B = carrier << 4 | modulator waveform
+#define BENCH_MARK_SAMPLE         0x42    // CONFIG_A = low byte, CONFIG_B = high byte of an audio sample
+#define BENCH_MARK_DONE           0xFF
+
+// samples measured per row
+#define BENCH_CONTROL_CALLS       32
+#define BENCH_AUDIO_CALLS_PER_CONTROL 8
+
+#define BENCH_CPU_FREQUENCY       16000000UL
+
+#endif
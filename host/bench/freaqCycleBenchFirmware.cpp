@@ -0,0 +1,164 @@
+/*----------------------------------------------------------------------------------------------------------
+ * freaqCycleBenchFirmware.cpp
+ *
+ * AVR benchmark firmware, run under simavr by freaqCycleBench.cpp - not for flashing to the synth
+ *
+ * Links the real engine & sketch but replaces the Arduino main() so Mozzi's interrupts never start.
+ * For every FM mode and every carrier/modulator waveform combination, plays a note on both voices and
+ * brackets calls to noteOn() (on one voice and on both), updateControl(), MutatingFM::updateAudio() and 
+ * the sketch's two-voice updateAudio() with GPIOR0 markers for the harness to time.
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <Arduino.h>
+#include <avr/sleep.h>
+
+#include "avSource.h"
+#include "freaqCycleBench.h"
+
+#define BENCH_NOTE          45
+#define BENCH_NOTE_LENGTH   500
+
+// stop the compiler moving work across a marker
+#define BENCH_BARRIER() asm volatile("" ::: "memory")
+
+// defined in MutantFMSynth.ino
+extern MutatingFM voice0;
+extern MutatingFM voice1;
+void initialiseSources();
+int  updateAudio();
+
+volatile int benchSink;
+
+// the waveforms timed.  the extra waveforms of INTERPOLATED_WAVETABLE_CELLS builds are table reads like the sine
+static const uint8_t benchWaveforms[] = {WAVEFORM_SIN, WAVEFORM_SAW, WAVEFORM_REVSAW, WAVEFORM_SQUARE, WAVEFORM_NOISE, WAVEFORM_NULL};
+
+
+inline void benchMark(uint8_t mark)
+{
+  BENCH_BARRIER();
+  GPIOR0 = mark;
+  BENCH_BARRIER();
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * setVoice
+ * steps the voice's toggles round to the given FM mode and waveforms and sets mid-range parameters
+ *----------------------------------------------------------------------------------------------------------
+ */
+void setVoice(MutatingFM* voice, uint8_t fmMode, uint8_t carrierWaveform, uint8_t modulatorWaveform)
+{
+  while (voice->getFMMode() != fmMode)                       voice->toggleFMMode();
+  while (voice->getCarrierWaveform() != carrierWaveform)     voice->toggleCarrierWaveform();
+  while (voice->getModulatorWaveform() != modulatorWaveform) voice->toggleModulatorWaveform();
+
+  voice->setParam(SYNTH_PARAMETER_MOD_AMOUNT, 800);
+  voice->setParam(SYNTH_PARAMETER_MOD_RATIO, 500);
+  voice->setParam(SYNTH_PARAMETER_MOD_AMOUNT_LFODEPTH, 300);
+  voice->setParam(SYNTH_PARAMETER_ENVELOPE_DECAY, 400);
+
+  #ifdef ENABLE_WAVETABLE_MORPH
+  voice->setParam(SYNTH_PARAMETER_CARRIER_MORPH, 500);
+  voice->setParam(SYNTH_PARAMETER_CARRIER_MORPH_LFODEPTH, 300);
+  #endif
+
+  #ifdef ENABLE_MODULATOR_FEEDBACK
+  voice->setParam(SYNTH_PARAMETER_MODULATOR_FEEDBACK, 500);
+  #endif
+
+  #if FM_OPERATORS > 2
+  voice->setParam(SYNTH_PARAMETER_OPERATOR_RATIO, 600);
+  voice->setParam(SYNTH_PARAMETER_OPERATOR_AMOUNT, 500);
+  #endif
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * benchRow
+ * times one FM mode / waveform combination
+ *----------------------------------------------------------------------------------------------------------
+ */
+void benchRow(uint8_t fmMode, uint8_t carrierIndex, uint8_t modulatorIndex)
+{
+  setVoice(&voice0, fmMode, benchWaveforms[carrierIndex], benchWaveforms[modulatorIndex]);
+  setVoice(&voice1, fmMode, benchWaveforms[carrierIndex], benchWaveforms[modulatorIndex]);
+
+  // alternate notes so setFreqs() always sees a new note
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    benchMark(BENCH_MARK_START(BENCH_REGION_NOTE_ON));
+    voice0.noteOn(BENCH_NOTE + i, 255, BENCH_NOTE_LENGTH);
+    benchMark(BENCH_MARK_END(BENCH_REGION_NOTE_ON));
+  }
+
+  // both tracks playing on the same step
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    benchMark(BENCH_MARK_START(BENCH_REGION_NOTE_ON_PAIR));
+    voice0.noteOn(BENCH_NOTE + 12 + i, 255, BENCH_NOTE_LENGTH);
+    voice1.noteOn(BENCH_NOTE + 7 + i, 255, BENCH_NOTE_LENGTH);
+    benchMark(BENCH_MARK_END(BENCH_REGION_NOTE_ON_PAIR));
+  }
+
+  for (uint8_t c = 0; c < BENCH_CONTROL_CALLS; c++)
+  {
+    benchMark(BENCH_MARK_START(BENCH_REGION_CONTROL));
+    voice0.updateControl();
+    benchMark(BENCH_MARK_END(BENCH_REGION_CONTROL));
+    voice1.updateControl();
+
+    for (uint8_t a = 0; a < BENCH_AUDIO_CALLS_PER_CONTROL; a++)
+    {
+      benchMark(BENCH_MARK_START(BENCH_REGION_VOICE_AUDIO));
+      benchSink = voice0.updateAudio();
+      benchMark(BENCH_MARK_END(BENCH_REGION_VOICE_AUDIO));
+
+      benchMark(BENCH_MARK_START(BENCH_REGION_MIX_AUDIO));
+      benchSink = updateAudio();
+      benchMark(BENCH_MARK_END(BENCH_REGION_MIX_AUDIO));
+    }
+  }
+
+  GPIOR1 = fmMode;
+  GPIOR2 = (carrierIndex << 4) | modulatorIndex;
+  benchMark(BENCH_MARK_ROW_END);
+}
+
+
+int main()
+{
+  initialiseSources();
+
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    benchMark(BENCH_MARK_START(BENCH_REGION_CALIBRATE));
+    benchMark(BENCH_MARK_END(BENCH_REGION_CALIBRATE));
+  }
+
+  GPIOR1 = sizeof(benchWaveforms);
+  benchMark(BENCH_MARK_INFO);
+
+  for (uint8_t fmMode = 0; fmMode < MAX_FM_MODES; fmMode++)
+  {
+    for (uint8_t carrierIndex = 0; carrierIndex < sizeof(benchWaveforms); carrierIndex++)
+    {
+      for (uint8_t modulatorIndex = 0; modulatorIndex < sizeof(benchWaveforms); modulatorIndex++)
+      {
+        benchRow(fmMode, carrierIndex, modulatorIndex);
+      }
+    }
+  }
+
+  benchMark(BENCH_MARK_DONE);
+
+  // sleeping with interrupts off ends the simulation
+  cli();
+  sleep_mode();
+
+  return 0;
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+#----------------------------------------------------------------------------------------------------------
+# optionCycles.sh
+#
+# benchmarks the baseline firmware and each compile option's benchmark firmware with avrCycleBench.sh, and
+# writes every option's table with the change from the baseline after each figure (see cycleDiff.sh).  the
+# figures to record with a commit that changes the cost of an option.  needs what avrCycleBench.sh needs
+#
+# usage:  host/bench/optionCycles.sh output.md [firmware env...]
+#    firmware envs default to every bench_avr_* env in platformio.ini
+#----------------------------------------------------------------------------------------------------------
+set -e
+cd "$(dirname "$0")/../.."
+repo="$(pwd)"
+
+if [ $# -lt 1 ]; then
+  echo "usage: $0 output.md [firmware env...]" >&2
+  exit 1
+fi
+
+output="$1"
+shift
+if [ $# -eq 0 ]; then
+  set -- $(sed -n 's/^\[env:\(bench_avr_[a-z0-9_]*\)\]$/\1/p' platformio.ini)
+fi
+
+work="$(mktemp -d)"
+trap 'rm -rf "$work"' EXIT
+
+host/bench/avrCycleBench.sh "$work/bench_avr.md"
+cat "$work/bench_avr.md" > "$output"
+
+for firmwareEnv in "$@"; do
+  host/bench/avrCycleBench.sh "$work/$firmwareEnv.md" "$firmwareEnv"
+  printf '\n\n' >> "$output"
+  (cd "$work" && "$repo/host/bench/cycleDiff.sh" bench_avr.md "$firmwareEnv.md") >> "$output"
+done
+
+echo "wrote $output"
@@ -0,0 +1,162 @@
+/*----------------------------------------------------------------------------------------------------------
+ * fmRatioError.cpp
+ *
+ * Error check for the integer modulator frequency calculation (MutatingFM::getModulatorPhaseIncrement)
+ *
+ * Compares it with the float calculation setFreqs() used before, for every FM mode, every MOD_RATIO value
+ * and every MIDI note.  The integer version starts from the carrier phase increment table, the float version
+ * from Q16n16_mtof() in single precision, as on AVR, and its result is converted to a phase increment as
+ * Oscil::setFreq_Q16n16() does.  Prints the largest difference per FM mode as phase increment steps, Hz and
+ * cents.  Exits with status 1 if any difference is over the bound:  0.01 cent, or 2 phase increment steps 
+ * (0.00025Hz) times the modulator:carrier ratio, whichever is larger.  Either version can only set the carrier
+ * to the nearest step, and the modulator multiplies that step by the ratio.
+ *
+ * Combinations where the modulator would be 65536Hz or more are skipped - they don't fit a Q16n16 value
+ * in either version.
+ *
+ * usage:  program
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <mozzi_midi.h>
+
+#include "avSource.h"
+#include "midinotephaseinc_uint32.h"
+
+#define MAX_ERROR_STEPS   2
+#define STEPS_PER_HZ      (65536.0 * SIN2048_NUM_CELLS / AUDIO_RATE)
+#define MAX_ERROR_CENTS   0.01
+
+static const char* fmModeNames[] = {"exponential", "linear high", "linear low", "free"};
+
+
+struct ErrorStats
+{
+  uint32_t  count;
+  uint32_t  skipped;
+  uint32_t  maxSteps;
+  double    maxHz;
+  double    maxCents;
+  uint32_t  failures;
+};
+
+
+// the modulator frequency calculation from setFreqs() before it was changed to integer maths
+static Q16n16 getModulatorFrequencyFloat(Q16n16 carrierFrequency, uint8_t fmMode, uint16_t modRatio)
+{
+  uint8_t multIndex;
+  float freqshift[17] = {0,0.03125,0.0625,0.125,0.25,0.5,1,1.5,2,2.5,3,3.5,4,5,6,7,8};
+
+  switch(fmMode)
+  {
+    case FM_MODE_EXPONENTIAL:
+      multIndex = modRatio/61;
+
+      if (multIndex>0)
+      {
+        return carrierFrequency * freqshift[multIndex];
+      }
+      return carrierFrequency*((float)1.0 / ((512-modRatio)+1));
+
+    case FM_MODE_LINEAR_HIGH:
+      return carrierFrequency*(float)modRatio/100;
+
+    case FM_MODE_LINEAR_LOW:
+      return carrierFrequency*(float)modRatio/10000;
+
+    case FM_MODE_FREE:
+      return (uint32_t)modRatio << 17;
+  }
+  return 0;
+}
+
+
+// the float version's result before conversion to Q16n16, to find the combinations that don't fit
+static double getModulatorHz(Q16n16 carrierFrequency, uint8_t fmMode, uint16_t modRatio)
+{
+  double carrierHz = carrierFrequency / 65536.0;
+
+  switch(fmMode)
+  {
+    case FM_MODE_EXPONENTIAL:
+    {
+      static const double freqshift[17] = {0,0.03125,0.0625,0.125,0.25,0.5,1,1.5,2,2.5,3,3.5,4,5,6,7,8};
+      return modRatio/61 > 0 ? carrierHz * freqshift[modRatio/61] : carrierHz / (513 - modRatio);
+    }
+    case FM_MODE_LINEAR_HIGH:   return carrierHz * modRatio / 100;
+    case FM_MODE_LINEAR_LOW:    return carrierHz * modRatio / 10000;
+  }
+  return modRatio * 2.0;
+}
+
+
+int main()
+{
+  ErrorStats  modes[MAX_FM_MODES] = {};
+  uint32_t    failures            = 0;
+
+  for (uint8_t fmMode = 0; fmMode < MAX_FM_MODES; fmMode++)
+  {
+    ErrorStats& stats = modes[fmMode];
+
+    for (uint8_t midiNote = 1; midiNote < 128; midiNote++)
+    {
+      Q16n16    carrierFrequency      = Q16n16_mtof(Q8n0_to_Q16n16(midiNote));
+      uint32_t  carrierPhaseIncrement = MIDINOTE_PHASEINC_DATA[midiNote];
+
+      for (uint16_t modRatio = 0; modRatio < 1024; modRatio++)
+      {
+        if (getModulatorHz(carrierFrequency, fmMode, modRatio) >= 65535.0)
+        {
+          stats.skipped++;
+          continue;
+        }
+
+        uint32_t  expected  = (uint64_t)getModulatorFrequencyFloat(carrierFrequency, fmMode, modRatio) * SIN2048_NUM_CELLS / AUDIO_RATE;
+        uint32_t  actual    = MutatingFM::getModulatorPhaseIncrement(carrierPhaseIncrement, fmMode, modRatio);
+        uint32_t  steps     = actual > expected ? actual - expected : expected - actual;
+        double    cents     = (expected > 0 && actual > 0) ? fabs(1200.0 * log2((double)actual / expected)) : 0;
+        double    ratio     = (double)expected / carrierPhaseIncrement;
+        uint32_t  maxSteps  = MAX_ERROR_STEPS * (ratio > 1 ? ratio : 1);
+
+        stats.count++;
+        if (steps > stats.maxSteps)                       stats.maxSteps  = steps;
+        if (steps / STEPS_PER_HZ > stats.maxHz)           stats.maxHz     = steps / STEPS_PER_HZ;
+        if (steps > maxSteps && cents > stats.maxCents)   stats.maxCents  = cents;
+
+        if (steps > maxSteps && cents > MAX_ERROR_CENTS)
+        {
+          if (failures < 10)
+          {
+            fprintf(stderr, "%s note %u ratio %u: float %u, integer %u\n", fmModeNames[fmMode], midiNote, modRatio, expected, actual);
+          }
+          stats.failures++;
+          failures++;
+        }
+      }
+    }
+  }
+
+  printf("## integer vs float modulator frequency\n\n");
+  printf("| FM mode     | combinations | skipped | max error (increment steps) | max error (Hz) | max error over the step bound (cents) | over bound |\n");
+  printf("|-------------|--------|-------|--------|------------|----------|-----|\n");
+
+  for (uint8_t fmMode = 0; fmMode < MAX_FM_MODES; fmMode++)
+  {
+    ErrorStats& stats = modes[fmMode];
+
+    printf("| %-11s | %6u | %5u | %6u | %10.6f | %8.5f | %3u |\n",
+           fmModeNames[fmMode], stats.count, stats.skipped, stats.maxSteps, stats.maxHz, stats.maxCents, stats.failures);
+  }
+
+  printf("\nbound: %.2f cent or %d phase increment steps x ratio, whichever is larger\n", MAX_ERROR_CENTS, MAX_ERROR_STEPS);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------------------------------------------
+ * freaqHostMain.cpp
+ * 
+ * Entry point for the native build:  boots the sketch, starts the sequencer and runs the engine for a
+ * number of seconds of audio as fast as the host allows, then reports a checksum of the output and the 
+ * speed relative to real time.  Use it to check that the engine still builds & runs on Linux.
+ * 
+ * usage:  program [seconds]
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "MutantFMSynthHost.h"
+
+#define DEFAULT_RUN_SECONDS 10
+
+
+int main(int argc, char** argv)
+{
+  uint32_t  seconds   = argc > 1 ? atoi(argv[1]) : DEFAULT_RUN_SECONDS;
+  uint32_t  samples   = seconds * AUDIO_RATE;
+  uint32_t  checksum  = 0;
+  int       peak      = 0;
+  clock_t   startTime;
+  double    elapsed;
+
+  setup();
+  startStopSequencer();
+
+  startTime = clock();
+
+  for (uint32_t i = 0; i < samples; i++)
+  {
+    int sample = hostAudioHook();
+
+    checksum = checksum * 31 + (uint8_t)sample;
+    if (abs(sample) > peak) peak = abs(sample);
+  }
+
+  elapsed = (double)(clock() - startTime) / CLOCKS_PER_SEC;
+
+  printf("rendered %u samples (%u s) at control rate %d Hz\n", samples, seconds, hostGetControlRate());
+  printf("checksum %08x, peak %d\n", checksum, peak);
+  printf("%.3f s cpu, %.1fx real time\n", elapsed, elapsed > 0 ? seconds / elapsed : 0.0);
+
+  return 0;
+}
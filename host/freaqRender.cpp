@@ -0,0 +1,294 @@
+/*----------------------------------------------------------------------------------------------------------
+ * freaqRender.cpp
+ *
+ * Offline renderer:  runs the full synth (sequencer + both FM voices) on the simulated Mozzi clock
+ * and writes the output of updateAudio() to a WAV file, much faster than real time.
+ *
+ * Every input is fixed on the command line, so the same arguments always give the same file.
+ * Use it to A/B test changes to the DSP code by rendering before & after and comparing the files.
+ *
+ * usage:  program [options]
+ *    -o, --output FILE       WAV file to write (default freaq.wav)
+ *    -t, --seconds N         length of the render (default 30)
+ *    -s, --seed N            random seed for the sequencer (default 1)
+ *    -c, --scale N           scale 0-5, see SCALEMODE_* (default 1 = minor)
+ *    -a, --algorithm N       mutation algorithm 0-3, see MUTATE_ALGO_* (default 0)
+ *    -k, --knob NAME=VALUE   set a knob 0-1023.  repeat for each knob.  names as on the faceplate:
+ *                            mutation, wobble, population, attack, lifespan, decay, ratio, depth
+ *    -g, --gain N            voice volume 0-255 as set by Func+Lifespan (default 255)
+ *    -C, --carrier NAME      carrier waveform of both voices:  sin, saw, revsaw, square, noise or off (default sin)
+ *    -M, --modulator NAME    modulator waveform of both voices, names as for -C (default sin)
+ *    -f, --fm-mode N         FM mode of both voices 0-3, see FM_MODE_* (default 0 = exponential)
+ *    -m, --mix N             how the voices are mixed, see VOICE_MIX_* - needs ENABLE_VOICE_MIX_MODES (default 0 = sum)
+ *    -S, --stats             print the peak, RMS and largest sample-to-sample step of the render to stdout
+ *    -v, --verbose           echo the sketch's serial output to stderr
+ *
+ * knobs that aren't set are at 512 (centre).  knob settings are applied to both voices.
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <getopt.h>
+
+#include <mozzi_rand.h>
+
+#include "MutantFMSynthHost.h"
+#include "WavWriter.h"
+
+#define RENDER_DEFAULT_SECONDS  30
+#define RENDER_DEFAULT_KNOB     512
+#define RENDER_KNOB_COUNT       8
+#define RENDER_WAVEFORM_COUNT   6
+
+// faceplate names for A0-A7
+static const char* knobNames[RENDER_KNOB_COUNT] = {"mutation", "wobble", "population", "attack", "lifespan", "decay", "ratio", "depth"};
+
+// waveforms every build has, for -C & -M
+static const char*   waveformNames[RENDER_WAVEFORM_COUNT]  = {"sin", "saw", "revsaw", "square", "noise", "off"};
+static const uint8_t waveformIndex[RENDER_WAVEFORM_COUNT]  = {WAVEFORM_SIN, WAVEFORM_SAW, WAVEFORM_REVSAW, WAVEFORM_SQUARE, WAVEFORM_NOISE, WAVEFORM_NULL};
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * parseKnob
+ * parses NAME=VALUE into the knob array.  returns false if the name or value is invalid
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool parseKnob(const char* arg, int* knobValues)
+{
+  const char* equals = strchr(arg, '=');
+
+  if (!equals)
+  {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < RENDER_KNOB_COUNT; i++)
+  {
+    if (strlen(knobNames[i]) == (size_t)(equals - arg) && strncmp(arg, knobNames[i], equals - arg) == 0)
+    {
+      int value = atoi(equals + 1);
+
+      if (value < 0 || value > 1023)
+      {
+        return false;
+      }
+      knobValues[i] = value;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * parseWaveform
+ * returns the WAVEFORM_* index for a name, or -1 if it isn't one of waveformNames
+ *----------------------------------------------------------------------------------------------------------
+ */
+static int parseWaveform(const char* name)
+{
+  for (uint8_t i = 0; i < RENDER_WAVEFORM_COUNT; i++)
+  {
+    if (strcmp(name, waveformNames[i]) == 0)
+    {
+      return waveformIndex[i];
+    }
+  }
+  return -1;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * setVoiceSound
+ * steps the voice's carrier & modulator waveforms and FM mode round to the given ones, as the buttons do
+ *----------------------------------------------------------------------------------------------------------
+ */
+static void setVoiceSound(MutatingFM& voice, uint8_t carrier, uint8_t modulator, uint8_t fmMode)
+{
+  while (voice.getCarrierWaveform() != carrier)
+  {
+    voice.toggleCarrierWaveform();
+  }
+  while (voice.getModulatorWaveform() != modulator)
+  {
+    voice.toggleModulatorWaveform();
+  }
+  while (voice.getFMMode() != fmMode)
+  {
+    voice.toggleFMMode();
+  }
+}
+
+
+static void printUsage(const char* program)
+{
+  fprintf(stderr, "usage: %s [-o file.wav] [-t seconds] [-s seed] [-c scale] [-a algorithm] [-k knob=value]... [-g gain] [-C carrier] [-M modulator] [-f fm-mode] [-m mix] [-S] [-v]\n", program);
+  fprintf(stderr, "knobs: mutation, wobble, population, attack, lifespan, decay, ratio, depth (0-1023)\n");
+  fprintf(stderr, "waveforms: sin, saw, revsaw, square, noise, off\n");
+}
+
+
+int main(int argc, char** argv)
+{
+  const char* outputFile  = "freaq.wav";
+  uint32_t    seconds     = RENDER_DEFAULT_SECONDS;
+  uint32_t    seed        = 1;
+  uint8_t     scale       = SCALEMODE_MINOR;
+  uint8_t     algorithm   = MUTATE_ALGO_DEFAULT;
+  uint8_t     gain        = 255;
+  uint8_t     mix         = VOICE_MIX_SUM;
+  int         carrier     = WAVEFORM_SIN;
+  int         modulator   = WAVEFORM_SIN;
+  uint8_t     fmMode      = FM_MODE_EXPONENTIAL;
+  bool        printStats  = false;
+  int         knobValues[RENDER_KNOB_COUNT];
+  WavWriter   wav;
+  clock_t     startTime;
+  double      elapsed;
+  double      sumSquares  = 0;
+  int         peak        = 0;
+  int         maxStep     = 0;
+  int         lastSample  = 0;
+  int         option;
+
+  static const struct option longOptions[] =
+  {
+    {"output",    required_argument, 0, 'o'},
+    {"seconds",   required_argument, 0, 't'},
+    {"seed",      required_argument, 0, 's'},
+    {"scale",     required_argument, 0, 'c'},
+    {"algorithm", required_argument, 0, 'a'},
+    {"knob",      required_argument, 0, 'k'},
+    {"gain",      required_argument, 0, 'g'},
+    {"carrier",   required_argument, 0, 'C'},
+    {"modulator", required_argument, 0, 'M'},
+    {"fm-mode",   required_argument, 0, 'f'},
+    {"mix",       required_argument, 0, 'm'},
+    {"stats",     no_argument,       0, 'S'},
+    {"verbose",   no_argument,       0, 'v'},
+    {0, 0, 0, 0}
+  };
+
+  for (uint8_t i = 0; i < RENDER_KNOB_COUNT; i++)
+  {
+    knobValues[i] = RENDER_DEFAULT_KNOB;
+  }
+
+  while ((option = getopt_long(argc, argv, "o:t:s:c:a:k:g:C:M:f:m:Sv", longOptions, NULL)) != -1)
+  {
+    switch (option)
+    {
+      case 'o': outputFile  = optarg;                     break;
+      case 't': seconds     = strtoul(optarg, NULL, 10);  break;
+      case 's': seed        = strtoul(optarg, NULL, 10);  break;
+      case 'c': scale       = atoi(optarg) % MAX_SCALE_COUNT;       break;
+      case 'a': algorithm   = atoi(optarg) % MAX_MUTATE_ALGO_COUNT; break;
+      case 'g': gain        = constrain(atoi(optarg), 0, 255);  break;
+      case 'f': fmMode      = atoi(optarg) % MAX_FM_MODES;      break;
+      case 'C':
+      case 'M':
+        if (parseWaveform(optarg) < 0)
+        {
+          fprintf(stderr, "unknown waveform: %s\n", optarg);
+          printUsage(argv[0]);
+          return 1;
+        }
+        (option == 'C' ? carrier : modulator) = parseWaveform(optarg);
+        break;
+
+      case 'm': mix         = atoi(optarg) % MAX_VOICE_MIX_MODES;   break;
+      case 'S': printStats  = true;                       break;
+      case 'v': hostSetSerialEcho(true);                  break;
+
+      case 'k':
+        if (!parseKnob(optarg, knobValues))
+        {
+          fprintf(stderr, "invalid knob setting '%s'\n", optarg);
+          printUsage(argv[0]);
+          return 1;
+        }
+        break;
+
+      default:
+        printUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  if (!wav.open(outputFile, AUDIO_RATE))
+  {
+    fprintf(stderr, "can't create %s\n", outputFile);
+    return 1;
+  }
+
+  // seed before setup() so the initial sequence comes from the given seed
+  randSeed(seed);
+  setup();
+
+  sequencer.setScale(scale);
+  while (sequencer.getAlgorithm() != algorithm)
+  {
+    sequencer.nextAlgorithm();
+  }
+  hostSetKnobs(knobValues);
+  voice0.setGain(gain);
+  voice1.setGain(gain);
+  setVoiceSound(voice0, carrier, modulator, fmMode);
+  setVoiceSound(voice1, carrier, modulator, fmMode);
+
+  #ifdef ENABLE_VOICE_MIX_MODES
+  setVoiceMixMode(mix);
+  #else
+  if (mix != VOICE_MIX_SUM)
+  {
+    fprintf(stderr, "-m needs a build with ENABLE_VOICE_MIX_MODES\n");
+    return 1;
+  }
+  #endif
+
+  hostResetClock();
+  startStopSequencer();
+
+  startTime = clock();
+
+  for (uint32_t i = 0; i < seconds * AUDIO_RATE; i++)
+  {
+    int sample = hostAudioHook();
+
+    // scale the 8 bit output up to 16 bits
+    wav.write(sample << 8);
+
+    if (abs(sample) > peak)                         peak    = abs(sample);
+    if (i > 0 && abs(sample - lastSample) > maxStep) maxStep = abs(sample - lastSample);
+    sumSquares += (double)sample * sample;
+    lastSample  = sample;
+  }
+
+  elapsed = (double)(clock() - startTime) / CLOCKS_PER_SEC;
+
+  if (!wav.close())
+  {
+    fprintf(stderr, "error writing %s\n", outputFile);
+    return 1;
+  }
+
+  if (printStats)
+  {
+    // levels in dB relative to a full scale 8 bit square wave.  silence reports -999
+    double rms = sqrt(sumSquares / ((double)seconds * AUDIO_RATE));
+    printf("peak %d rms %.3f rms_db %.2f max_step %d\n", peak, rms, rms > 0 ? 20.0 * log10(rms / 128.0) : -999.0, maxStep);
+  }
+
+  fprintf(stderr, "wrote %u s to %s (seed %u, scale %u, algorithm %u) in %.2f s, %.0fx real time\n",
+          seconds, outputFile, seed, scale, algorithm, elapsed, elapsed > 0 ? seconds / elapsed : 0.0);
+
+  return 0;
+}
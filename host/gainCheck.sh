@@ -0,0 +1,62 @@
+#!/bin/sh
+#----------------------------------------------------------------------------------------------------------
+# gainCheck.sh
+#
+# checks the per-voice volume (MutatingFM::setGain) on the host.  renders the same patch at a range of
+# volume settings and compares the measured level with the gain curve in src/gaincurve256_uint8.h
+#
+# fails if full volume changes the output, if a level is more than 1dB from the curve (volume 96 and
+# up - below that the 8 bit output is mostly quantisation), if volume 0 isn't silent, or if turning the
+# volume down makes any sample-to-sample step larger than at full volume (ie adds clicks)
+#
+# usage:  host/gainCheck.sh [renderer arguments]
+#----------------------------------------------------------------------------------------------------------
+set -e
+cd "$(dirname "$0")/.."
+
+render=".pio/build/render/program"
+output=".pio/gainCheck.wav"
+args="-t 10 $*"
+
+pio run -s -e render
+
+# full volume must be bit-identical to a render that never calls setGain with anything else
+$render -o "$output.default" $args 2>/dev/null
+$render -o "$output" -g 255 $args 2>/dev/null
+if ! cmp -s "$output.default" "$output"; then
+  echo "FAIL  volume 255 changes the output"
+  exit 1
+fi
+
+reference=$($render -o "$output" -g 255 -S $args 2>/dev/null)
+failures=0
+
+echo "volume  level  curve dB  measured dB  peak  max step"
+
+for volume in 255 240 224 192 160 128 96 64 32 16 0; do
+  # curve level from the table - cells are listed 16 per line after the opening brace
+  level=$(sed -n '/GAINCURVE256_DATA/,/};/p' src/gaincurve256_uint8.h | tr -d ' {};\n' | sed 's/^.*=//' | cut -d, -f$((volume + 1)))
+  stats=$($render -o "$output" -g $volume -S $args 2>/dev/null)
+
+  # fields 1-8 are the full volume stats, 9-16 this volume:  peak N rms N rms_db N max_step N
+  result=$(echo "$reference $stats" | awk -v volume=$volume -v level=$level '{
+    curve     = 20 * log((level + 1) / 256) / log(10)
+    measured  = ($14 > -999) ? $14 - $6 : -999
+    status    = "ok"
+    if (volume >= 96 && (measured - curve > 1 || curve - measured > 1)) status = "FAIL level"
+    if (volume == 0 && $10 != 0)  status = "FAIL not silent"
+    if ($16 > $8)                 status = "FAIL step"
+    printf "%6d  %5d  %8.2f  %11.2f  %4d  %8d  %s\n", volume, level, curve, measured, $10, $16, status
+  }')
+  echo "$result"
+
+  case "$result" in
+    *FAIL*) failures=$((failures + 1)) ;;
+  esac
+done
+
+if [ $failures -ne 0 ]; then
+  echo "$failures volume setting(s) failed"
+  exit 1
+fi
+echo "voice volume ok"
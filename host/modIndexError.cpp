@@ -0,0 +1,128 @@
+/*----------------------------------------------------------------------------------------------------------
+ * modIndexError.cpp
+ *
+ * Error analysis for ENABLE_16BIT_MODULATION_INDEX (see MutatingFM::nextPhaseModulation)
+ *
+ * The normal audio path multiplies the 32 bit Q16n16 modulation amount by each modulator sample and
+ * shifts right 8.  The 16 bit mode rounds the amount to 16 bits once per control tick and multiplies
+ * that instead.  This compares the two for every modulation amount the voice can produce and every
+ * modulator sample, at random carrier phases, and reports the difference in the carrier table position
+ * and in the sine carrier's output, per range of modulation depth.
+ *
+ * usage:  program [step]
+ *    step is the modulation amount increment (default 1 = every amount)
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <mozzi_fixmath.h>
+#include <tables/sin2048_int8.h>
+
+// largest amount updateControl() can produce:  MOD_AMOUNT and LFO depth are 0-1023, envelope & LFO 0-255
+#define MAX_MODULATOR_AMOUNT  ((uint32_t)1023 * 255 * 2)
+#define ERROR_BANDS           8
+#define TABLE_CELLS           SIN2048_NUM_CELLS
+
+
+struct ErrorStats
+{
+  uint32_t  count;
+  int32_t   maxCellError;
+  double    totalCellError;
+  int       maxSampleError;
+  double    errorPower;
+  double    signalPower;
+};
+
+
+// the two versions of MutatingFM::nextPhaseModulation()
+static inline Q15n16 phaseModulation32(Q16n16 modulatorAmount, int8_t modulatorSample)
+{
+  return modulatorAmount * modulatorSample >> 8;
+}
+
+static inline Q15n16 phaseModulation16(Q16n16 modulatorAmount, int8_t modulatorSample)
+{
+  int16_t modulationIndex = (modulatorAmount + 128) >> 8;
+  return (int32_t)modulationIndex * modulatorSample;
+}
+
+
+// table position as in Oscil::phMod()
+static inline uint16_t tableCell(uint32_t phase, Q15n16 phaseModulation)
+{
+  return ((phase + ((uint32_t)phaseModulation * TABLE_CELLS)) >> 16) & (TABLE_CELLS - 1);
+}
+
+
+int main(int argc, char** argv)
+{
+  uint32_t    step      = argc > 1 ? strtoul(argv[1], NULL, 10) : 1;
+  uint32_t    random    = 2463534242UL;
+  ErrorStats  bands[ERROR_BANDS + 1] = {};
+
+  if (step == 0)
+  {
+    step = 1;
+  }
+
+  for (uint32_t amount = 0; amount <= MAX_MODULATOR_AMOUNT; amount += step)
+  {
+    ErrorStats& band = bands[amount * ERROR_BANDS / (MAX_MODULATOR_AMOUNT + 1)];
+
+    for (int modulatorSample = -128; modulatorSample <= 127; modulatorSample++)
+    {
+      // xorshift32 for the carrier phase
+      random ^= random << 13;
+      random ^= random >> 17;
+      random ^= random << 5;
+
+      uint16_t  cell32      = tableCell(random, phaseModulation32(amount, modulatorSample));
+      uint16_t  cell16      = tableCell(random, phaseModulation16(amount, modulatorSample));
+      int32_t   cellError   = abs((int32_t)((cell16 - cell32 + TABLE_CELLS / 2) & (TABLE_CELLS - 1)) - TABLE_CELLS / 2);
+      int       sample32    = SIN2048_DATA[cell32];
+      int       sampleError = abs(SIN2048_DATA[cell16] - sample32);
+
+      band.count++;
+      band.totalCellError += cellError;
+      band.errorPower     += (double)sampleError * sampleError;
+      band.signalPower    += (double)sample32 * sample32;
+      if (cellError > band.maxCellError)     band.maxCellError   = cellError;
+      if (sampleError > band.maxSampleError) band.maxSampleError = sampleError;
+    }
+  }
+
+  // the last band only holds MAX_MODULATOR_AMOUNT itself
+  ErrorStats& last = bands[ERROR_BANDS - 1];
+  last.count          += bands[ERROR_BANDS].count;
+  last.totalCellError += bands[ERROR_BANDS].totalCellError;
+  last.errorPower     += bands[ERROR_BANDS].errorPower;
+  last.signalPower    += bands[ERROR_BANDS].signalPower;
+  if (bands[ERROR_BANDS].maxCellError > last.maxCellError)     last.maxCellError   = bands[ERROR_BANDS].maxCellError;
+  if (bands[ERROR_BANDS].maxSampleError > last.maxSampleError) last.maxSampleError = bands[ERROR_BANDS].maxSampleError;
+
+  printf("## 16 bit modulation index vs 32 bit - sine carrier, %u-cell table\n\n", TABLE_CELLS);
+  printf("| modulation amount | max table error (cells) | mean table error (cells) | max sample error | carrier SNR |\n");
+  printf("|-------------------|-------|-------|-------|----------|\n");
+
+  for (uint8_t i = 0; i < ERROR_BANDS; i++)
+  {
+    ErrorStats& band = bands[i];
+    double      snr  = band.errorPower > 0 ? 10.0 * log10(band.signalPower / band.errorPower) : INFINITY;
+
+    printf("| %7u - %-7u | %5d | %5.3f | %5d | %6.1f dB |\n",
+           i * (MAX_MODULATOR_AMOUNT + 1) / ERROR_BANDS, (i + 1) * (MAX_MODULATOR_AMOUNT + 1) / ERROR_BANDS - 1,
+           band.maxCellError, band.count ? band.totalCellError / band.count : 0.0,
+           band.maxSampleError, snr);
+  }
+
+  printf("\nfor comparison, quantising a full scale sine to 8 bits gives about 50 dB SNR\n");
+  return 0;
+}
@@ -0,0 +1,61 @@
+#!/bin/sh
+#----------------------------------------------------------------------------------------------------------
+# renderCompare.sh
+#
+# equivalence check for alternative DSP builds.  renders the same set of patches with two renderer
+# environments from platformio.ini and checks the WAV files are bit-identical
+#
+# usage:  host/renderCompare.sh ENV [REFERENCE_ENV]
+#    ENV            renderer build to check, eg render_fused
+#    REFERENCE_ENV  renderer build to compare against (default render)
+#
+# the patches cover every mutation algorithm, the six waveforms every build has on the carrier & modulator, 
+# and all four FM modes.  exits with 1 if any patch differs
+#----------------------------------------------------------------------------------------------------------
+set -e
+cd "$(dirname "$0")/.."
+
+if [ -z "$1" ]; then
+  echo "usage: $0 ENV [REFERENCE_ENV]" >&2
+  exit 1
+fi
+
+testEnv="$1"
+referenceEnv="${2:-render}"
+outputDir=".pio/renderCompare"
+failures=0
+
+pio run -s -e "$referenceEnv"
+pio run -s -e "$testEnv"
+mkdir -p "$outputDir"
+
+# one patch per line:  name  renderer arguments
+while read -r name args; do
+  .pio/build/"$referenceEnv"/program -o "$outputDir/$name.$referenceEnv.wav" $args 2>/dev/null
+  .pio/build/"$testEnv"/program      -o "$outputDir/$name.$testEnv.wav"      $args 2>/dev/null
+
+  if cmp -s "$outputDir/$name.$referenceEnv.wav" "$outputDir/$name.$testEnv.wav"; then
+    echo "same     $name"
+  else
+    echo "DIFFERS  $name"
+    failures=$((failures + 1))
+  fi
+done <<PATCHES
+default     -t 20
+deep        -t 20 -s 7 -k depth=800 -k ratio=300
+wobble      -t 20 -s 3 -a 2 -c 4 -k depth=300 -k ratio=900 -k wobble=900 -k lifespan=800
+fast        -t 20 -s 11 -a 1 -c 2 -k attack=0 -k decay=100 -k depth=1023 -k ratio=1023
+slow        -t 20 -s 5 -a 3 -c 0 -k attack=900 -k decay=900 -k population=900 -k depth=600 -k ratio=50
+saw         -t 20 -s 2 -C saw -M sin -k depth=700 -k ratio=400
+revsaw      -t 20 -s 4 -a 1 -C revsaw -M square -f 1 -k depth=900 -k ratio=600
+square      -t 20 -s 6 -a 2 -C square -M saw -f 2 -k depth=500 -k ratio=800 -k wobble=700
+noise       -t 20 -s 8 -C sin -M noise -f 3 -k depth=600 -k ratio=200
+carnoise    -t 20 -s 9 -a 3 -C noise -M revsaw -k depth=400
+off         -t 20 -s 10 -a 1 -C saw -M off -f 1 -k attack=300
+PATCHES
+
+if [ $failures -ne 0 ]; then
+  echo "$failures patch(es) differ between $testEnv and $referenceEnv"
+  exit 1
+fi
+echo "$testEnv matches $referenceEnv"
@@ -0,0 +1,476 @@
+/*----------------------------------------------------------------------------------------------------------
+ * sclToHeader.cpp
+ *
+ * Tuning compiler:  turns a Scala scale (.scl) and optional keyboard mapping (.kbm) into a tuning header for
+ * src/, in the same form as the wavetable headers.  Name the header in TUNING_HEADER in MutantFMSynthOptions.h
+ * to use it - see src/tuning.h
+ *
+ * The header holds the carrier phase increment for each of the 256 notes the sequencer can play, so a note
+ * costs one table read whatever the tuning, and the nearest note of the tuning to each equal tempered 
+ * semitone, which the sequencer uses to convert its scales when they're set up.
+ *
+ * Without a .kbm, notes map to successive degrees of the scale with note 0 on degree 0 at 8.1758Hz (MIDI 
+ * note 0 at A=440).  The sequencer treats note 0 and every period (scale size, or .kbm map size) above it
+ * as its C, so this keeps a C based tuning in the same register as equal temperament.  A .kbm sets the 
+ * mapping, reference note & frequency as in Scala.  Notes that aren't mapped play the nearest mapped note
+ * below.  Notes at or above the Nyquist frequency (8192Hz) are folded down by octaves until they're under it.
+ *
+ * Scala file formats:  https://www.huygens-fokker.org/scala/scl_format.html
+ *
+ * usage:  program [-k file.kbm] [-n name] [-o file.h] file.scl
+ *    -k, --kbm FILE      keyboard mapping
+ *    -n, --name NAME     tuning name for the header's table names (default from the .scl file name)
+ *    -o, --output FILE   header to write (default stdout)
+ *
+ * eg:  program -o src/tuning_19edo_uint32.h host/tunings/19edo.scl
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <getopt.h>
+
+#define TUNING_NUM_CELLS      256
+#define TUNING_AUDIO_RATE     16384
+#define TUNING_TABLE_CELLS    2048
+#define MAX_SCALE_NOTES       128
+#define MAX_LINE_LENGTH       512
+#define MAX_NAME_LENGTH       64
+#define NYQUIST_PHASE_INCREMENT  (1UL << 26)      // 8192Hz, half a cycle per sample
+#define MIDI_NOTE_0_HZ        8.17579891564
+
+#define UNMAPPED              -1
+
+
+struct Scale
+{
+  char    description[MAX_LINE_LENGTH];
+  int     noteCount;
+  double  cents[MAX_SCALE_NOTES];   // degrees 1 to noteCount - the last is the period
+};
+
+struct KeyboardMapping
+{
+  int     mapSize;
+  int     firstNote;
+  int     lastNote;
+  int     middleNote;
+  int     referenceNote;
+  double  referenceFrequency;
+  int     octaveDegree;
+  int     map[MAX_SCALE_NOTES];
+};
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * readLine
+ * reads the next line that isn't a Scala comment (starting with !).  returns false at the end of the file
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool readLine(FILE* file, char* line)
+{
+  while (fgets(line, MAX_LINE_LENGTH, file))
+  {
+    line[strcspn(line, "\r\n")] = 0;
+    if (line[0] != '!')
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+static bool readInt(FILE* file, int* value)
+{
+  char line[MAX_LINE_LENGTH];
+  return readLine(file, line) && sscanf(line, "%d", value) == 1;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * parsePitch
+ * a pitch is cents if it contains a full stop, otherwise a ratio (a/b) or whole number.  text after it is ignored
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool parsePitch(const char* line, double* cents)
+{
+  char    token[MAX_LINE_LENGTH];
+  double  numerator;
+  double  denominator = 1;
+
+  if (sscanf(line, " %s", token) != 1)
+  {
+    return false;
+  }
+
+  if (strchr(token, '.'))
+  {
+    *cents = atof(token);
+    return true;
+  }
+
+  if (sscanf(token, "%lf/%lf", &numerator, &denominator) < 1 || numerator <= 0 || denominator <= 0)
+  {
+    return false;
+  }
+  *cents = 1200.0 * log2(numerator / denominator);
+  return true;
+}
+
+
+static bool readScale(const char* fileName, Scale* scale)
+{
+  FILE* file = fopen(fileName, "r");
+  char  line[MAX_LINE_LENGTH];
+  bool  ok;
+
+  if (!file)
+  {
+    fprintf(stderr, "can't open %s\n", fileName);
+    return false;
+  }
+
+  ok = readLine(file, scale->description) && readInt(file, &scale->noteCount)
+       && scale->noteCount > 0 && scale->noteCount <= MAX_SCALE_NOTES;
+
+  for (int i = 0; ok && i < scale->noteCount; i++)
+  {
+    ok = readLine(file, line) && parsePitch(line, &scale->cents[i]);
+  }
+  fclose(file);
+
+  if (!ok)
+  {
+    fprintf(stderr, "%s isn't a valid .scl file (1 to %d notes)\n", fileName, MAX_SCALE_NOTES);
+    return false;
+  }
+  if (scale->cents[scale->noteCount - 1] <= 0)
+  {
+    fprintf(stderr, "%s: the last note (the period) must be above 1/1\n", fileName);
+    return false;
+  }
+  return true;
+}
+
+
+static bool readMapping(const char* fileName, KeyboardMapping* mapping)
+{
+  FILE* file = fopen(fileName, "r");
+  char  line[MAX_LINE_LENGTH];
+  bool  ok;
+
+  if (!file)
+  {
+    fprintf(stderr, "can't open %s\n", fileName);
+    return false;
+  }
+
+  ok = readInt(file, &mapping->mapSize) && mapping->mapSize >= 0 && mapping->mapSize <= MAX_SCALE_NOTES
+       && readInt(file, &mapping->firstNote)
+       && readInt(file, &mapping->lastNote)
+       && readInt(file, &mapping->middleNote)
+       && readInt(file, &mapping->referenceNote)
+       && readLine(file, line) && sscanf(line, "%lf", &mapping->referenceFrequency) == 1 && mapping->referenceFrequency > 0
+       && readInt(file, &mapping->octaveDegree);
+
+  // missing map entries are unmapped
+  for (int i = 0; ok && i < mapping->mapSize; i++)
+  {
+    if (!readLine(file, line) || sscanf(line, "%d", &mapping->map[i]) != 1)
+    {
+      mapping->map[i] = UNMAPPED;
+    }
+  }
+  fclose(file);
+
+  if (!ok)
+  {
+    fprintf(stderr, "%s isn't a valid .kbm file\n", fileName);
+    return false;
+  }
+  return true;
+}
+
+
+static int floorDivide(int a, int b)
+{
+  return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+
+// pitch of any scale degree, in cents above degree 0
+static double degreeCents(const Scale& scale, int degree)
+{
+  int octaves = floorDivide(degree, scale.noteCount);
+  int index   = degree - octaves * scale.noteCount;
+
+  return octaves * scale.cents[scale.noteCount - 1] + (index ? scale.cents[index - 1] : 0);
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * keyCents
+ * pitch of a note in cents above the middle note, or false if the mapping leaves it out
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool keyCents(const Scale& scale, const KeyboardMapping& mapping, int note, double* cents)
+{
+  int offset = note - mapping.middleNote;
+  int octaves;
+  int degree;
+
+  if (mapping.mapSize == 0)
+  {
+    *cents = degreeCents(scale, offset);
+    return true;
+  }
+
+  octaves = floorDivide(offset, mapping.mapSize);
+  degree  = mapping.map[offset - octaves * mapping.mapSize];
+
+  if (degree == UNMAPPED)
+  {
+    return false;
+  }
+
+  *cents = octaves * degreeCents(scale, mapping.octaveDegree ? mapping.octaveDegree : scale.noteCount) + degreeCents(scale, degree);
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * mappedKeyCents
+ * as keyCents, but notes outside the mapping take the pitch of the nearest mapped note below, or above if none
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool mappedKeyCents(const Scale& scale, const KeyboardMapping& mapping, int note, double* cents)
+{
+  for (int distance = 0; distance < TUNING_NUM_CELLS; distance++)
+  {
+    int below = note - distance;
+    int above = note + distance;
+
+    if (below >= mapping.firstNote && below <= mapping.lastNote && keyCents(scale, mapping, below, cents))
+    {
+      return true;
+    }
+    if (above >= mapping.firstNote && above <= mapping.lastNote && keyCents(scale, mapping, above, cents))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+static void printUsage(const char* program)
+{
+  fprintf(stderr, "usage: %s [-k file.kbm] [-n name] [-o file.h] file.scl\n", program);
+}
+
+
+int main(int argc, char** argv)
+{
+  const char*     kbmFile     = NULL;
+  const char*     outputFile  = NULL;
+  const char*     sclFile;
+  char            name[MAX_NAME_LENGTH]   = "";
+  char            upperName[MAX_NAME_LENGTH];
+  Scale           scale;
+  KeyboardMapping mapping;
+  double          referenceCents;
+  double          periodCents[MAX_SCALE_NOTES + 1];
+  uint32_t        phaseIncrements[TUNING_NUM_CELLS];
+  int             semitoneSteps[12];
+  int             notesPerOctave;
+  FILE*           output      = stdout;
+  int             option;
+
+  static const struct option longOptions[] =
+  {
+    {"kbm",     required_argument, 0, 'k'},
+    {"name",    required_argument, 0, 'n'},
+    {"output",  required_argument, 0, 'o'},
+    {0, 0, 0, 0}
+  };
+
+  while ((option = getopt_long(argc, argv, "k:n:o:", longOptions, NULL)) != -1)
+  {
+    switch (option)
+    {
+      case 'k': kbmFile     = optarg;                                 break;
+      case 'n': snprintf(name, sizeof(name), "%s", optarg);           break;
+      case 'o': outputFile  = optarg;                                 break;
+      default:
+        printUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  if (optind != argc - 1)
+  {
+    printUsage(argv[0]);
+    return 1;
+  }
+  sclFile = argv[optind];
+
+  if (!readScale(sclFile, &scale))
+  {
+    return 1;
+  }
+
+  // linear mapping from note 0 = MIDI note 0's frequency unless a .kbm is given
+  mapping.mapSize             = 0;
+  mapping.firstNote           = 0;
+  mapping.lastNote            = TUNING_NUM_CELLS - 1;
+  mapping.middleNote          = 0;
+  mapping.referenceNote       = 0;
+  mapping.referenceFrequency  = MIDI_NOTE_0_HZ;
+  mapping.octaveDegree        = 0;
+
+  if (kbmFile && !readMapping(kbmFile, &mapping))
+  {
+    return 1;
+  }
+
+  if (!keyCents(scale, mapping, mapping.referenceNote, &referenceCents))
+  {
+    fprintf(stderr, "the reference note %d isn't mapped\n", mapping.referenceNote);
+    return 1;
+  }
+
+  // default name from the .scl file name, letters & digits only
+  if (!name[0])
+  {
+    const char* baseName  = strrchr(sclFile, '/') ? strrchr(sclFile, '/') + 1 : sclFile;
+    int         length    = 0;
+
+    for (const char* c = baseName; *c && *c != '.' && length < MAX_NAME_LENGTH - 1; c++)
+    {
+      if (isalnum((unsigned char)*c))
+      {
+        name[length++] = tolower((unsigned char)*c);
+      }
+    }
+    name[length] = 0;
+  }
+
+  for (int i = 0; i < MAX_NAME_LENGTH; i++)
+  {
+    upperName[i] = toupper((unsigned char)name[i]);
+  }
+
+  if (!name[0])
+  {
+    fprintf(stderr, "no letters or digits in the tuning name - use -n\n");
+    return 1;
+  }
+
+  for (int note = 0; note < TUNING_NUM_CELLS; note++)
+  {
+    double cents;
+    double frequency;
+    double increment;
+
+    if (!mappedKeyCents(scale, mapping, note, &cents))
+    {
+      fprintf(stderr, "the mapping has no notes\n");
+      return 1;
+    }
+
+    frequency = mapping.referenceFrequency * pow(2.0, (cents - referenceCents) / 1200.0);
+    increment = frequency * 65536.0 * TUNING_TABLE_CELLS / TUNING_AUDIO_RATE;
+
+    // fold notes the oscillator can't play down by octaves, rather than clamping them all to one pitch
+    while (increment + 0.5 >= NYQUIST_PHASE_INCREMENT)
+    {
+      increment /= 2;
+    }
+    phaseIncrements[note] = (uint32_t)(increment + 0.5);
+  }
+
+  // nearest note to each equal tempered semitone, measured over one period of notes
+  notesPerOctave = mapping.mapSize ? mapping.mapSize : scale.noteCount;
+
+  for (int step = 0; step <= notesPerOctave; step++)
+  {
+    double cents;
+    double baseCents;
+
+    mappedKeyCents(scale, mapping, notesPerOctave + step, &cents);
+    mappedKeyCents(scale, mapping, notesPerOctave, &baseCents);
+    periodCents[step] = cents - baseCents;
+  }
+
+  for (int semitone = 0; semitone < 12; semitone++)
+  {
+    semitoneSteps[semitone] = 0;
+
+    for (int step = 1; step <= notesPerOctave; step++)
+    {
+      if (fabs(periodCents[step] - semitone * 100.0) < fabs(periodCents[semitoneSteps[semitone]] - semitone * 100.0))
+      {
+        semitoneSteps[semitone] = step;
+      }
+    }
+  }
+
+  if (outputFile && !(output = fopen(outputFile, "w")))
+  {
+    fprintf(stderr, "can't create %s\n", outputFile);
+    return 1;
+  }
+
+  fprintf(output, "/*\n");
+  fprintf(output, "  tuning_%s_uint32.h - defines the %s tuning for MutatingFM::setFreqs() and the sequencer's scales\n\n", name, name);
+  fprintf(output, "  %s\n\n", scale.description);
+  fprintf(output, "  generated by host/sclToHeader.cpp from %s%s%s - regenerate rather than editing\n", sclFile, kbmFile ? " and " : "", kbmFile ? kbmFile : "");
+  fprintf(output, "  %d notes per period.  to use it, #define TUNING_HEADER \"tuning_%s_uint32.h\" in MutantFMSynthOptions.h\n", notesPerOctave, name);
+  fprintf(output, "*/\n");
+  fprintf(output, "#ifndef TUNING_%s_UINT32_H_\n", upperName);
+  fprintf(output, "#define TUNING_%s_UINT32_H_\n\n", upperName);
+  fprintf(output, "#if ARDUINO >= 100\n #include \"Arduino.h\"\n#else\n #include \"WProgram.h\"\n#endif\n");
+  fprintf(output, "#include \"mozzi_pgmspace.h\"\n\n");
+  fprintf(output, "#define TUNING_%s_NUM_CELLS %d\n", upperName, TUNING_NUM_CELLS);
+  fprintf(output, "#define TUNING_%s_NOTES_PER_OCTAVE %d\n\n", upperName, notesPerOctave);
+
+  fprintf(output, "// names used by tuning.h\n");
+  fprintf(output, "#define TUNING_NUM_CELLS          TUNING_%s_NUM_CELLS\n", upperName);
+  fprintf(output, "#define TUNING_NOTES_PER_OCTAVE   TUNING_%s_NOTES_PER_OCTAVE\n", upperName);
+  fprintf(output, "#define TUNING_PHASEINC_DATA      TUNING_%s_DATA\n", upperName);
+  fprintf(output, "#define TUNING_SEMITONE_STEPS     TUNING_%s_SEMITONE_STEPS\n", upperName);
+  fprintf(output, "#define TUNING_AUDIO_RATE         %d\n", TUNING_AUDIO_RATE);
+  fprintf(output, "#define TUNING_TABLE_CELLS        %d\n\n", TUNING_TABLE_CELLS);
+
+  fprintf(output, "/** @ingroup tables\n%s carrier phase increment per note\n*/\n\n", name);
+  fprintf(output, "CONSTTABLE_STORAGE(uint32_t) TUNING_%s_DATA [%d]  =\n        {\n", upperName, TUNING_NUM_CELLS);
+  for (int note = 0; note < TUNING_NUM_CELLS; note++)
+  {
+    fprintf(output, "%s%lu", note == 0 ? "            " : (note % 8 == 0 ? "\n            ," : ","), (unsigned long)phaseIncrements[note]);
+  }
+  fprintf(output, "\n        };\n\n");
+
+  fprintf(output, "// nearest note of the tuning to each equal tempered semitone\n");
+  fprintf(output, "CONSTTABLE_STORAGE(uint8_t) TUNING_%s_SEMITONE_STEPS [12]  =\n        {\n            ", upperName);
+  for (int semitone = 0; semitone < 12; semitone++)
+  {
+    fprintf(output, "%s%d", semitone ? "," : "", semitoneSteps[semitone]);
+  }
+  fprintf(output, "\n        };\n\n\n");
+  fprintf(output, "#endif /* TUNING_%s_UINT32_H_ */\n", upperName);
+
+  if (output != stdout)
+  {
+    fclose(output);
+  }
+  return 0;
+}
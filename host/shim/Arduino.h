@@ -0,0 +1,119 @@
+/*----------------------------------------------------------------------------------------------------------
+ * Arduino.h
+ *
+ * Host stand-in for the parts of the Arduino AVR core used by the synth engine
+ *
+ * Pins, time and the serial port are simulated by MozziHost.cpp so that the engine code in src/
+ * compiles unmodified on Linux.  Analog & digital inputs can be driven by host tools via MozziHost.h
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+#include "binary.h"
+#include "avr/pgmspace.h"
+
+#ifndef ARDUINO
+#define ARDUINO 10805
+#endif
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH 1
+#define LOW  0
+
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+// analog pin numbers match the Nano
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+
+#define HOST_MAX_PINS 22
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+// the F() macro stores strings in flash on AVR - on the host it is a plain string
+#define F(string_literal) (string_literal)
+
+// the AVR core defines these as macros.  templates are used here so they don't break std headers included after this one
+// they compare & return by value in the type the macros' arithmetic would give - a reference would dangle to the parameter
+template <typename A, typename B> inline typename std::common_type<A, B>::type min(A a, B b)
+{
+  typedef typename std::common_type<A, B>::type C;
+  return (C)a < (C)b ? (C)a : (C)b;
+}
+
+template <typename A, typename B> inline typename std::common_type<A, B>::type max(A a, B b)
+{
+  typedef typename std::common_type<A, B>::type C;
+  return (C)a > (C)b ? (C)a : (C)b;
+}
+
+template <typename T, typename L, typename H> inline T constrain(T x, L low, H high)
+{
+  return x < low ? low : (x > high ? high : x);
+}
+
+void      pinMode(uint8_t pin, uint8_t mode);
+int       digitalRead(uint8_t pin);
+void      digitalWrite(uint8_t pin, uint8_t value);
+int       analogRead(uint8_t pin);
+void      delay(unsigned long ms);
+void      delayMicroseconds(unsigned int us);
+unsigned long micros();
+unsigned long millis();
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * HostSerial
+ * swallows everything written to the serial port unless echo is enabled with hostSetSerialEcho()
+ *----------------------------------------------------------------------------------------------------------
+ */
+class HostSerial
+{
+  public:
+    void begin(unsigned long baud);
+
+    size_t write(uint8_t value);
+
+    size_t print(const char* value);
+    size_t print(char value);
+    size_t print(int value, int base = DEC);
+    size_t print(unsigned int value, int base = DEC);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+    size_t print(unsigned char value, int base = DEC);
+
+    size_t println();
+    template <typename T> size_t println(T value)  { size_t n = print(value); return n + println(); }
+};
+
+extern HostSerial Serial;
+
+#endif
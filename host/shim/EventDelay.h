@@ -0,0 +1,48 @@
+/*----------------------------------------------------------------------------------------------------------
+ * EventDelay.h
+ *
+ * Host stand-in for Mozzi's EventDelay - a millisecond timer counted in audio ticks
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_EVENTDELAY_H
+#define HOST_EVENTDELAY_H
+
+#include "MozziGuts.h"
+
+class EventDelay
+{
+  public:
+    EventDelay(unsigned int delay_milliseconds = 0) : AUDIO_TICKS_PER_MILLISECOND((float)AUDIO_RATE / 1000.0f)
+    {
+      set(delay_milliseconds);
+      deadline = 0;
+    }
+
+    inline void set(unsigned int delay_milliseconds)
+    {
+      ticks = (unsigned long)(AUDIO_TICKS_PER_MILLISECOND * delay_milliseconds);
+    }
+
+    inline void start()
+    {
+      deadline = audioTicks() + ticks;
+    }
+
+    inline void start(unsigned int delay_milliseconds)
+    {
+      set(delay_milliseconds);
+      start();
+    }
+
+    inline bool ready()
+    {
+      return audioTicks() >= deadline;
+    }
+
+  protected:
+    const float   AUDIO_TICKS_PER_MILLISECOND;
+    unsigned long deadline;
+    unsigned long ticks;
+};
+
+#endif
@@ -0,0 +1,29 @@
+/*----------------------------------------------------------------------------------------------------------
+ * IntMap.h
+ *
+ * Host stand-in for Mozzi's integer range mapper
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_INTMAP_H
+#define HOST_INTMAP_H
+
+class IntMap
+{
+  public:
+    IntMap(int in_min, int in_max, int out_min, int out_max)
+      : _IN_MIN(in_min), _IN_MAX(in_max), _OUT_MIN(out_min), _OUT_MAX(out_max),
+        _MULTIPLIER((256L * (out_max - out_min)) / (in_max - in_min))
+    {
+    }
+
+    int operator()(int n) const
+    {
+      return (int)(((_MULTIPLIER * (n - _IN_MIN)) >> 8) + _OUT_MIN);
+    }
+
+  private:
+    const int   _IN_MIN, _IN_MAX, _OUT_MIN, _OUT_MAX;
+    const long  _MULTIPLIER;
+};
+
+#endif
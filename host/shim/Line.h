@@ -0,0 +1,52 @@
+/*----------------------------------------------------------------------------------------------------------
+ * Line.h
+ *
+ * Host stand-in for Mozzi's linear interpolator
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_LINE_H
+#define HOST_LINE_H
+
+template <class T>
+class Line
+{
+  public:
+    Line() {}
+
+    inline T next()
+    {
+      current_value += step_size;
+      return current_value;
+    }
+
+    inline void set(T value)
+    {
+      current_value = value;
+    }
+
+    inline void set(T targetvalue, T num_steps)
+    {
+      if (num_steps)
+      {
+        T numerator = targetvalue - current_value;
+        step_size   = numerator / num_steps;
+      }
+      else
+      {
+        step_size     = 0;
+        current_value = targetvalue;
+      }
+    }
+
+    inline void set(T startvalue, T targetvalue, T num_steps)
+    {
+      set(startvalue);
+      set(targetvalue, num_steps);
+    }
+
+  private:
+    T current_value;
+    T step_size;
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*----------------------------------------------------------------------------------------------------------
+ * LowPassFilter.h
+ *
+ * Host stand-in for Mozzi's 8 bit resonant low pass filter
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_LOWPASSFILTER_H
+#define HOST_LOWPASSFILTER_H
+
+#include <stdint.h>
+
+class LowPassFilter
+{
+  public:
+    LowPassFilter() : q(0), f(0), fb(0), buf0(0), buf1(0) {}
+
+    void setCutoffFreq(uint8_t cutoff)
+    {
+      f  = cutoff;
+      fb = q + ucfxmul(q, SHIFTED_1 - cutoff);
+    }
+
+    void setResonance(uint8_t resonance)
+    {
+      q = resonance;
+    }
+
+    void setCutoffFreqAndResonance(uint8_t cutoff, uint8_t resonance)
+    {
+      f  = cutoff;
+      q  = resonance;
+      fb = q + ucfxmul(q, SHIFTED_1 - cutoff);
+    }
+
+    inline int next(int in)
+    {
+      buf0 += fxmul(((in - buf0) + fxmul(fb, buf0 - buf1)), f);
+      buf1 += ifxmul(buf0 - buf1, f);
+      return buf1;
+    }
+
+  private:
+    uint8_t       q;
+    uint8_t       f;
+    unsigned int  fb;
+    int           buf0, buf1;
+
+    static const uint8_t FX_SHIFT  = 8;
+    static const uint8_t SHIFTED_1 = 255;
+
+    inline unsigned int ucfxmul(uint8_t a, uint8_t b) { return (((unsigned int)a * b) >> FX_SHIFT); }
+    inline int          ifxmul(int a, uint8_t b)      { return ((a * b) >> FX_SHIFT); }
+    inline long         fxmul(long a, int b)          { return ((a * b) >> FX_SHIFT); }
+};
+
+#endif
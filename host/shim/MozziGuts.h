@@ -0,0 +1,64 @@
+/*----------------------------------------------------------------------------------------------------------
+ * MozziGuts.h
+ *
+ * Host stand-in for the Mozzi core
+ *
+ * Mirrors the Nano's STANDARD_PLUS configuration: 16384Hz audio rate & 8 bit output.
+ * There is no audio interrupt on the host - hostAudioHook() in MozziHost.h runs the control & audio 
+ * hooks for one sample and advances the simulated clock returned by audioTicks() & mozziMicros()
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZIGUTS_H
+#define HOST_MOZZIGUTS_H
+
+#include "Arduino.h"
+#include "mozzi_analog.h"
+
+#define AUDIO_RATE 16384
+#define AUDIO_BITS 8
+#define AUDIO_BIAS ((uint8_t) 1 << (AUDIO_BITS - 1))
+#define MICROS_PER_AUDIO_TICK (1000000 / AUDIO_RATE)
+
+// Mozzi's default, unless CONTROL_RATE is already defined
+#ifndef CONTROL_RATE
+#define CONTROL_RATE 64
+#endif
+
+#define SCALE_AUDIO(x, bits)  ((bits) > AUDIO_BITS ? (x) >> ((bits) - AUDIO_BITS) : (x) << (AUDIO_BITS - (bits)))
+#define CLIP_AUDIO(x)         constrain((x), (-(int16_t) AUDIO_BIAS), (int16_t) AUDIO_BIAS - 1)
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MonoOutput
+ * a single audio sample, as returned by the sketch's updateAudio()
+ *----------------------------------------------------------------------------------------------------------
+ */
+struct MonoOutput
+{
+  MonoOutput(int l = 0) : _l(l) {}
+
+  static inline MonoOutput fromNBit(uint8_t bits, int16_t l)  { return MonoOutput(SCALE_AUDIO(l, bits)); }
+  static inline MonoOutput fromNBit(uint8_t bits, int32_t l)  { return MonoOutput(SCALE_AUDIO(l, bits)); }
+  static inline MonoOutput from8Bit(int16_t l)                { return fromNBit(8, l); }
+  static inline MonoOutput from16Bit(int16_t l)               { return fromNBit(16, l); }
+
+  MonoOutput& clip()        { _l = CLIP_AUDIO(_l); return *this; }
+  int         l() const     { return _l; }
+  operator    int() const   { return _l; }
+
+  private:
+    int _l;
+};
+
+
+void          startMozzi(int control_rate_hz = CONTROL_RATE);
+void          stopMozzi();
+void          audioHook();
+unsigned long audioTicks();
+unsigned long mozziMicros();
+
+// implemented by the sketch
+void updateControl();
+int  updateAudio();
+
+#endif
@@ -0,0 +1,334 @@
+/*----------------------------------------------------------------------------------------------------------
+ * MozziHost.cpp
+ *
+ * Implements the simulated Nano behind the host Arduino & Mozzi stand-ins
+ *
+ * time only moves when hostAudioHook() is called, so a render runs as fast as the host can go 
+ * and is deterministic for a given random seed
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+
+#include "Arduino.h"
+#include "SPI.h"
+#include "MozziGuts.h"
+#include "mozzi_rand.h"
+#include "MozziHost.h"
+
+HostSerial  Serial;
+HostSPI     SPI;
+
+static unsigned long  audioTickCount        = 0;
+static int            controlRate           = CONTROL_RATE;
+static unsigned int   updateControlTimeout  = AUDIO_RATE / CONTROL_RATE - 1;
+static unsigned int   updateControlCounter  = 0;
+static bool           serialEcho            = false;
+
+static int            analogInput[HOST_MAX_PINS];
+static uint8_t        digitalInput[HOST_MAX_PINS];
+static uint8_t        digitalOutput[HOST_MAX_PINS];
+
+static uint32_t       xorshiftX = 132456789;
+static uint32_t       xorshiftY = 362436069;
+static uint32_t       xorshiftZ = 521288629;
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * Mozzi core
+ *----------------------------------------------------------------------------------------------------------
+ */
+void startMozzi(int control_rate_hz)
+{
+  controlRate           = control_rate_hz;
+  updateControlTimeout  = AUDIO_RATE / control_rate_hz - 1;
+  updateControlCounter  = 0;
+}
+
+
+void stopMozzi()
+{
+}
+
+
+void audioHook()
+{
+  hostAudioHook();
+}
+
+
+unsigned long audioTicks()
+{
+  return audioTickCount;
+}
+
+
+unsigned long mozziMicros()
+{
+  return audioTickCount * MICROS_PER_AUDIO_TICK;
+}
+
+
+int mozziAnalogRead(uint8_t pin)
+{
+  return pin < HOST_MAX_PINS ? analogInput[pin] : 0;
+}
+
+
+void setupFastAnalogRead(int8_t speed)
+{
+}
+
+
+void adcDisconnectAllDigitalIns()
+{
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * host controls
+ *----------------------------------------------------------------------------------------------------------
+ */
+int hostAudioHook()
+{
+  // same scheduling as Mozzi's audioHook(): control update on the first sample of each control period
+  if (updateControlCounter == 0)
+  {
+    updateControlCounter = updateControlTimeout;
+    updateControl();
+  }
+  else
+  {
+    --updateControlCounter;
+  }
+
+  int sample = MonoOutput(updateAudio()).clip();
+  audioTickCount++;
+
+  return sample;
+}
+
+
+void hostResetClock()
+{
+  audioTickCount        = 0;
+  updateControlCounter  = 0;
+}
+
+
+void hostSetAnalogInput(uint8_t pin, int value)
+{
+  if (pin < HOST_MAX_PINS) analogInput[pin] = value;
+}
+
+
+void hostSetDigitalInput(uint8_t pin, uint8_t value)
+{
+  if (pin < HOST_MAX_PINS) digitalInput[pin] = value;
+}
+
+
+uint8_t hostGetDigitalOutput(uint8_t pin)
+{
+  return pin < HOST_MAX_PINS ? digitalOutput[pin] : 0;
+}
+
+
+int hostGetControlRate()
+{
+  return controlRate;
+}
+
+
+void hostSetSerialEcho(bool echo)
+{
+  serialEcho = echo;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * Arduino core
+ *----------------------------------------------------------------------------------------------------------
+ */
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+
+int digitalRead(uint8_t pin)
+{
+  return pin < HOST_MAX_PINS ? digitalInput[pin] : LOW;
+}
+
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin < HOST_MAX_PINS) digitalOutput[pin] = value;
+}
+
+
+int analogRead(uint8_t pin)
+{
+  return mozziAnalogRead(pin);
+}
+
+
+// Mozzi owns the timers on the Nano, so delay() doesn't advance the audio clock
+void delay(unsigned long ms)
+{
+}
+
+
+void delayMicroseconds(unsigned int us)
+{
+}
+
+
+unsigned long micros()
+{
+  return mozziMicros();
+}
+
+
+unsigned long millis()
+{
+  return mozziMicros() / 1000;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * mozzi_rand - xorshift96, as used by Mozzi
+ *----------------------------------------------------------------------------------------------------------
+ */
+uint32_t xorshift96()
+{
+  uint32_t t;
+
+  xorshiftX ^= xorshiftX << 16;
+  xorshiftX ^= xorshiftX >> 5;
+  xorshiftX ^= xorshiftX << 1;
+
+  t         = xorshiftX;
+  xorshiftX = xorshiftY;
+  xorshiftY = xorshiftZ;
+  xorshiftZ = t ^ xorshiftX ^ xorshiftY;
+
+  return xorshiftZ;
+}
+
+
+void xorshiftSeed(uint32_t seed)
+{
+  xorshiftX = seed;
+}
+
+
+void randSeed(uint32_t seed)
+{
+  xorshiftX = seed;
+}
+
+
+// on the Nano this seeds from ADC noise - the host uses a fixed value so renders stay repeatable
+void randSeed()
+{
+  xorshiftX = 132456789;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * HostSerial
+ *----------------------------------------------------------------------------------------------------------
+ */
+void HostSerial::begin(unsigned long baud)
+{
+}
+
+
+size_t HostSerial::write(uint8_t value)
+{
+  if (serialEcho) fputc(value, stderr);
+  return 1;
+}
+
+
+size_t HostSerial::print(const char* value)
+{
+  return serialEcho ? fprintf(stderr, "%s", value) : strlen(value);
+}
+
+
+size_t HostSerial::print(char value)
+{
+  return write(value);
+}
+
+
+size_t HostSerial::print(unsigned char value, int base)
+{
+  return print((unsigned long)value, base);
+}
+
+
+size_t HostSerial::print(int value, int base)
+{
+  return print((long)value, base);
+}
+
+
+size_t HostSerial::print(unsigned int value, int base)
+{
+  return print((unsigned long)value, base);
+}
+
+
+size_t HostSerial::print(long value, int base)
+{
+  if (value < 0 && base == DEC)
+  {
+    return print('-') + print((unsigned long)-value, base);
+  }
+  return print((unsigned long)value, base);
+}
+
+
+size_t HostSerial::print(unsigned long value, int base)
+{
+  char    buf[8 * sizeof(long) + 1];
+  char*   str = &buf[sizeof(buf) - 1];
+
+  if (base < 2) base = DEC;
+  *str = '\0';
+
+  do
+  {
+    char digit  = value % base;
+    value      /= base;
+    *--str      = digit < 10 ? digit + '0' : digit + 'A' - 10;
+  } while (value);
+
+  return print(str);
+}
+
+
+size_t HostSerial::print(double value, int digits)
+{
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.*f", digits, value);
+  return print(buf);
+}
+
+
+size_t HostSerial::println()
+{
+  return print("\r\n");
+}
@@ -0,0 +1,35 @@
+/*----------------------------------------------------------------------------------------------------------
+ * MozziHost.h
+ *
+ * Host-side controls for the simulated Nano:  drives the Mozzi hooks one sample at a time and
+ * sets the values seen by the sketch on its analog & digital inputs
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZIHOST_H
+#define HOST_MOZZIHOST_H
+
+#include <stdint.h>
+
+// runs updateControl() when due, then updateAudio(), and advances the clock by one audio tick
+// returns the clipped output sample, as it would be written to the PWM pin
+int     hostAudioHook();
+
+// resets the simulated clock and the control-rate divider.  does not reset the sketch state
+void    hostResetClock();
+
+void    hostSetAnalogInput(uint8_t pin, int value);
+void    hostSetDigitalInput(uint8_t pin, uint8_t value);
+uint8_t hostGetDigitalOutput(uint8_t pin);
+
+// control rate passed to startMozzi() by the sketch
+int     hostGetControlRate();
+
+// echo the sketch's serial output to stderr
+void    hostSetSerialEcho(bool echo);
+
+#endif
@@ -0,0 +1,87 @@
+/*----------------------------------------------------------------------------------------------------------
+ * Oscil.h
+ *
+ * Host stand-in for Mozzi's wavetable oscillator
+ * phase is a 32 bit accumulator with 16 fractional bits, as in the library
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_OSCIL_H
+#define HOST_OSCIL_H
+
+#include "MozziGuts.h"
+#include "mozzi_fixmath.h"
+#include "mozzi_pgmspace.h"
+
+#define OSCIL_F_BITS 16
+#define OSCIL_F_BITS_AS_MULTIPLIER 65536
+
+template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE>
+class Oscil
+{
+  public:
+    // like the library, the constructors leave the phase & frequency alone so that a voice which sets the 
+    // frequency of a global oscillator before the oscillator's own constructor has run keeps its setting
+    Oscil(const int8_t* TABLE_NAME) : table(TABLE_NAME) {}
+    Oscil() {}
+
+    inline int8_t next()
+    {
+      incrementPhase();
+      return readTable();
+    }
+
+    inline int8_t phMod(Q15n16 phmod_proportion)
+    {
+      incrementPhase();
+      return FLASH_OR_RAM_READ<const int8_t>(table + (((phase_fractional + ((uint32_t)phmod_proportion * NUM_TABLE_CELLS)) >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
+    }
+
+    inline void setTable(const int8_t* TABLE_NAME)      { table = TABLE_NAME; }
+    inline void setPhase(unsigned int phase)            { phase_fractional = (uint32_t)phase << OSCIL_F_BITS; }
+    inline void setPhaseFractional(uint32_t phase)      { phase_fractional = phase; }
+    inline uint32_t getPhaseFractional()                { return phase_fractional; }
+
+    inline void setFreq(int frequency)
+    {
+      phase_increment_fractional = ((uint32_t)frequency) * ((OSCIL_F_BITS_AS_MULTIPLIER * NUM_TABLE_CELLS) / UPDATE_RATE);
+    }
+
+    inline void setFreq(float frequency)
+    {
+      phase_increment_fractional = (uint32_t)((((float)NUM_TABLE_CELLS * frequency) / UPDATE_RATE) * OSCIL_F_BITS_AS_MULTIPLIER);
+    }
+
+    inline void setFreq_Q16n16(Q16n16 frequency)
+    {
+      phase_increment_fractional = (uint32_t)(((uint64_t)frequency * NUM_TABLE_CELLS) / UPDATE_RATE);
+    }
+
+    inline uint32_t phaseIncFromFreq(int frequency)
+    {
+      return ((uint32_t)frequency) * ((OSCIL_F_BITS_AS_MULTIPLIER * NUM_TABLE_CELLS) / UPDATE_RATE);
+    }
+
+    inline void setPhaseInc(uint32_t phaseinc_fractional)  { phase_increment_fractional = phaseinc_fractional; }
+
+    inline int8_t atIndex(unsigned int index)
+    {
+      return FLASH_OR_RAM_READ<const int8_t>(table + (index & (NUM_TABLE_CELLS - 1)));
+    }
+
+  private:
+    inline void incrementPhase()
+    {
+      phase_fractional += phase_increment_fractional;
+    }
+
+    inline int8_t readTable()
+    {
+      return FLASH_OR_RAM_READ<const int8_t>(table + ((phase_fractional >> OSCIL_F_BITS) & (NUM_TABLE_CELLS - 1)));
+    }
+
+    const int8_t* table;
+    uint32_t      phase_fractional;
+    uint32_t      phase_increment_fractional;
+};
+
+#endif
@@ -0,0 +1,23 @@
+/*----------------------------------------------------------------------------------------------------------
+ * SPI.h
+ *
+ * Host stand-in for the Arduino SPI library - transfers are discarded
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+class HostSPI
+{
+  public:
+    void    begin()                     {}
+    void    end()                       {}
+    void    setBitOrder(uint8_t order)  {}
+    uint8_t transfer(uint8_t value)     { return 0; }
+};
+
+extern HostSPI SPI;
+
+#endif
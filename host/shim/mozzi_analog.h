@@ -0,0 +1,16 @@
+/*----------------------------------------------------------------------------------------------------------
+ * mozzi_analog.h
+ *
+ * Host stand-in for Mozzi's analog input - reads return the values set with hostSetAnalogInput()
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZI_ANALOG_H
+#define HOST_MOZZI_ANALOG_H
+
+#include <stdint.h>
+
+int   mozziAnalogRead(uint8_t pin);
+void  setupFastAnalogRead(int8_t speed = 0);
+void  adcDisconnectAllDigitalIns();
+
+#endif
@@ -0,0 +1,34 @@
+/*----------------------------------------------------------------------------------------------------------
+ * mozzi_fixmath.h
+ *
+ * Host stand-in for the subset of Mozzi's fixed point types & conversions used by the synth
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZI_FIXMATH_H
+#define HOST_MOZZI_FIXMATH_H
+
+#include <stdint.h>
+
+typedef int8_t    Q0n7;
+typedef uint8_t   Q0n8;
+typedef uint8_t   Q8n0;
+typedef int16_t   Q7n8;
+typedef uint16_t  Q8n8;
+typedef uint16_t  Q0n16;
+typedef uint16_t  Q16n0;
+typedef int32_t   Q15n16;
+typedef uint32_t  Q16n16;
+typedef uint32_t  Q24n8;
+typedef uint32_t  Q32n0;
+
+#define Q8n0_to_Q15n16(a)   ((Q15n16)(a) << 16)
+#define Q8n0_to_Q16n16(a)   ((Q16n16)(a) << 16)
+#define Q15n16_to_Q8n0(a)   ((Q8n0)((a) >> 16))
+#define Q16n16_to_Q16n0(a)  ((Q16n0)((a) >> 16))
+#define Q16n16_to_float(a)  (((float)(a)) / 65536)
+#define Q15n16_to_float(a)  (((float)(a)) / 65536)
+#define float_to_Q16n16(a)  ((Q16n16)((a) * 65536))
+#define float_to_Q15n16(a)  ((Q15n16)((a) * 65536))
+#define float_to_Q24n8(a)   ((Q24n8)((a) * 256))
+
+#endif
@@ -0,0 +1,34 @@
+/*----------------------------------------------------------------------------------------------------------
+ * mozzi_midi.h
+ *
+ * Host stand-in for Mozzi's midi-to-frequency conversions
+ * computed exactly rather than with Mozzi's interpolated lookup, so results can differ in the last bits
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZI_MIDI_H
+#define HOST_MOZZI_MIDI_H
+
+#include <math.h>
+#include "mozzi_fixmath.h"
+
+inline float mtof(float midival)
+{
+  return 440.0f * powf(2.0f, (midival - 69.0f) / 12.0f);
+}
+
+inline int mtof(uint8_t midival)
+{
+  return (int)(mtof((float)midival) + 0.5f);
+}
+
+inline int mtof(int midival)
+{
+  return (int)(mtof((float)midival) + 0.5f);
+}
+
+inline Q16n16 Q16n16_mtof(Q16n16 midival_fractional)
+{
+  return (Q16n16)(65536.0 * 440.0 * pow(2.0, ((double)midival_fractional / 65536.0 - 69.0) / 12.0) + 0.5);
+}
+
+#endif
@@ -0,0 +1,19 @@
+/*----------------------------------------------------------------------------------------------------------
+ * mozzi_pgmspace.h
+ *
+ * Host stand-in for Mozzi's table storage macros
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZI_PGMSPACE_H
+#define HOST_MOZZI_PGMSPACE_H
+
+#include "avr/pgmspace.h"
+
+#define CONSTTABLE_STORAGE(X) const X
+
+template<typename T> inline T FLASH_OR_RAM_READ(T* address)
+{
+  return *address;
+}
+
+#endif
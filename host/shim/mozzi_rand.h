@@ -0,0 +1,29 @@
+/*----------------------------------------------------------------------------------------------------------
+ * mozzi_rand.h
+ *
+ * Host stand-in for Mozzi's xorshift96 random functions
+ * same generator & scaling as the library, so a given seed produces the same sequence as the Nano
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef HOST_MOZZI_RAND_H
+#define HOST_MOZZI_RAND_H
+
+#include <stdint.h>
+
+uint32_t  xorshift96();
+void      xorshiftSeed(uint32_t seed);
+void      randSeed(uint32_t seed);
+void      randSeed();
+
+inline int8_t   rand(int8_t maxval)         { return (int8_t)  (((int16_t)maxval * (int8_t)(xorshift96() & 0xFF)) >> 8); }
+inline uint8_t  rand(uint8_t maxval)        { return (uint8_t) (((uint16_t)maxval * (uint8_t)(xorshift96() & 0xFF)) >> 8); }
+inline int      rand(int maxval)            { return (int)     (((int32_t)maxval * (int32_t)(xorshift96() & 0xFFFF)) >> 16); }
+inline unsigned int rand(unsigned int maxval) { return (unsigned int) (((uint32_t)maxval * (xorshift96() & 0xFFFF)) >> 16); }
+
+inline int8_t   rand(int8_t minval, int8_t maxval)    { return (int8_t) (rand((int8_t)(maxval - minval)) + minval); }
+inline uint8_t  rand(uint8_t minval, uint8_t maxval)  { return (uint8_t) (rand((uint8_t)(maxval - minval)) + minval); }
+inline int      rand(int minval, int maxval)          { return rand(maxval - minval) + minval; }
+
+inline uint8_t  randMidiNote()              { return rand((uint8_t)127) + 1; }
+
+#endif
@@ -0,0 +1,52 @@
+/*----------------------------------------------------------------------------------------------------------
+ * tables/sin512_int8.h
+ * 
+ * Host stand-in for the Mozzi 512-cell sine table
+ * Generated with the same formula as the Mozzi table, values may differ from the library by 1 LSB
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef SIN512_INT8_H_
+#define SIN512_INT8_H_
+
+#include "mozzi_pgmspace.h"
+
+#define SIN512_NUM_CELLS 512
+#define SIN512_SAMPLERATE 512
+
+CONSTTABLE_STORAGE(int8_t) SIN512_DATA [] =
+  {
+    0, 2, 3, 5, 6, 8, 9, 11, 12, 14, 16, 17, 19, 20, 22, 23,
+    25, 26, 28, 29, 31, 32, 34, 35, 37, 38, 40, 41, 43, 44, 46, 47,
+    49, 50, 51, 53, 54, 56, 57, 58, 60, 61, 63, 64, 65, 67, 68, 69,
+    71, 72, 73, 74, 76, 77, 78, 79, 81, 82, 83, 84, 85, 86, 88, 89,
+    90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    106, 106, 107, 108, 109, 110, 111, 111, 112, 113, 113, 114, 115, 115, 116, 117,
+    117, 118, 118, 119, 120, 120, 121, 121, 122, 122, 122, 123, 123, 124, 124, 124,
+    125, 125, 125, 125, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 125, 125, 125,
+    125, 124, 124, 124, 123, 123, 122, 122, 122, 121, 121, 120, 120, 119, 118, 118,
+    117, 117, 116, 115, 115, 114, 113, 113, 112, 111, 111, 110, 109, 108, 107, 106,
+    106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91,
+    90, 89, 88, 86, 85, 84, 83, 82, 81, 79, 78, 77, 76, 74, 73, 72,
+    71, 69, 68, 67, 65, 64, 63, 61, 60, 58, 57, 56, 54, 53, 51, 50,
+    49, 47, 46, 44, 43, 41, 40, 38, 37, 35, 34, 32, 31, 29, 28, 26,
+    25, 23, 22, 20, 19, 17, 16, 14, 12, 11, 9, 8, 6, 5, 3, 2,
+    0, -2, -3, -5, -6, -8, -9, -11, -12, -14, -16, -17, -19, -20, -22, -23,
+    -25, -26, -28, -29, -31, -32, -34, -35, -37, -38, -40, -41, -43, -44, -46, -47,
+    -49, -50, -51, -53, -54, -56, -57, -58, -60, -61, -63, -64, -65, -67, -68, -69,
+    -71, -72, -73, -74, -76, -77, -78, -79, -81, -82, -83, -84, -85, -86, -88, -89,
+    -90, -91, -92, -93, -94, -95, -96, -97, -98, -99, -100, -101, -102, -103, -104, -105,
+    -106, -106, -107, -108, -109, -110, -111, -111, -112, -113, -113, -114, -115, -115, -116, -117,
+    -117, -118, -118, -119, -120, -120, -121, -121, -122, -122, -122, -123, -123, -124, -124, -124,
+    -125, -125, -125, -125, -126, -126, -126, -126, -126, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -126, -126, -126, -126, -126, -125, -125, -125,
+    -125, -124, -124, -124, -123, -123, -122, -122, -122, -121, -121, -120, -120, -119, -118, -118,
+    -117, -117, -116, -115, -115, -114, -113, -113, -112, -111, -111, -110, -109, -108, -107, -106,
+    -106, -105, -104, -103, -102, -101, -100, -99, -98, -97, -96, -95, -94, -93, -92, -91,
+    -90, -89, -88, -86, -85, -84, -83, -82, -81, -79, -78, -77, -76, -74, -73, -72,
+    -71, -69, -68, -67, -65, -64, -63, -61, -60, -58, -57, -56, -54, -53, -51, -50,
+    -49, -47, -46, -44, -43, -41, -40, -38, -37, -35, -34, -32, -31, -29, -28, -26,
+    -25, -23, -22, -20, -19, -17, -16, -14, -12, -11, -9, -8, -6, -5, -3, -2
+  };
+
+#endif
@@ -0,0 +1,183 @@
+/*----------------------------------------------------------------------------------------------------------
+ * softClipMeasure.cpp
+ *
+ * Levels & distortion of the voice mix with ENABLE_SOFT_CLIP_MIXER, across the voice volume & modulation amount
+ *
+ * Plays both voices a fifth apart at volumes from full down to quiet, for SYNTH_PARAMETER_MOD_AMOUNT from 0
+ * to 1023 at each, and mixes every pair of samples two ways:  as the sketch's plain sum, halved twice by fromNBit(9), and through the saturation
+ * curve in softclip512_int8.h as mixVoicesSum() does with the option.  The measurement is the first
+ * quarter second of each note, while the modulation envelope is near its peak.
+ *
+ * Prints the peak & RMS level of the sum and of both mixes in dBFS, and the THD each mix adds.  FM output
+ * is full of harmonics already, so a THD of the output would mostly measure the patch:  instead each mix is
+ * compared with the sum scaled by a straight gain (1/4 for the plain mix, the curve's slope at 0 for the
+ * soft clip) and the difference is counted as distortion - rounding, plus the saturation for loud sums.
+ *
+ * usage:  program [note] [volume]
+ *    MIDI note of track 1's voice, track 2's plays a fifth above (default 48)
+ *    volume of both voices, 0-255 as set with Func+Lifespan - measures just that volume instead of the
+ *    sweep from 255 to 64
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "avSource.h"
+
+#ifndef ENABLE_SOFT_CLIP_MIXER
+#error softClipMeasure needs ENABLE_SOFT_CLIP_MIXER - build it as env:soft_clip_measure
+#endif
+
+#define SETTLE_SAMPLES    256
+#define MEASURE_SAMPLES   (AUDIO_RATE / 4)
+#define NOTE_LENGTH       60000
+#define MOD_AMOUNT_STEP   256
+#define SLOPE_CELLS       32
+
+
+struct MixLevels
+{
+  int32_t   peak;
+  double    power;
+  double    errorPower;
+  double    referencePower;
+};
+
+
+static void addSample(MixLevels& levels, int32_t sample, double reference)
+{
+  if (abs(sample) > levels.peak)
+  {
+    levels.peak = abs(sample);
+  }
+  levels.power          += (double)sample * sample;
+  levels.errorPower     += (sample - reference) * (sample - reference);
+  levels.referencePower += reference * reference;
+}
+
+
+// level relative to fullScale in dB
+static double dBFS(double level, double fullScale)
+{
+  return level > 0 ? 20.0 * log10(level / fullScale) : -INFINITY;
+}
+
+
+static double rms(const MixLevels& levels)
+{
+  return sqrt(levels.power / MEASURE_SAMPLES);
+}
+
+
+static double thdPercent(const MixLevels& levels)
+{
+  return levels.referencePower > 0 ? 100.0 * sqrt(levels.errorPower / levels.referencePower) : 0;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * softClipSlope
+ * the gain of the saturation curve for quiet mixes:  the slope of the cells either side of 0
+ *----------------------------------------------------------------------------------------------------------
+ */
+static double softClipSlope()
+{
+  return (double)(softClipVoiceMix(SLOPE_CELLS) - softClipVoiceMix(-SLOPE_CELLS)) / (2 * SLOPE_CELLS);
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * measureVolume
+ * prints a row of the table for each modulation amount, with both voices at the given volume
+ *----------------------------------------------------------------------------------------------------------
+ */
+static void measureVolume(MutatingFM* voices, uint8_t note, uint8_t volume, double slope)
+{
+  voices[0].setGain(volume);
+  voices[1].setGain(volume);
+
+  for (uint16_t amount = 0; amount <= 1023; amount = (amount + MOD_AMOUNT_STEP > 1023 && amount < 1023) ? 1023 : amount + MOD_AMOUNT_STEP)
+  {
+    MixLevels plain     = {};
+    MixLevels softClip  = {};
+    int32_t   sumPeak   = 0;
+
+    for (uint8_t v = 0; v < 2; v++)
+    {
+      voices[v].setParam(SYNTH_PARAMETER_MOD_AMOUNT, amount);
+      voices[v].noteOn(note + 7 * v, 255, NOTE_LENGTH);
+    }
+
+    for (uint32_t i = 0; i < SETTLE_SAMPLES + MEASURE_SAMPLES; i++)
+    {
+      if ((i & ((1 << AUDIO_RAMP_SHIFT) - 1)) == 0)
+      {
+        voices[0].updateControl();
+        voices[1].updateControl();
+      }
+
+      int16_t sample0 = voices[0].nextSample();
+      int16_t sample1 = voices[1].nextSample();
+      int16_t sum     = sample0 + sample1;
+
+      if (i >= SETTLE_SAMPLES)
+      {
+        int plainMix  = MonoOutput::fromNBit(9, MonoOutput::fromNBit(9, sample0) + MonoOutput::fromNBit(9, sample1));
+        int softMix   = MonoOutput::fromNBit(8, softClipVoiceMix(sum));
+
+        if (abs(sum) > sumPeak)
+        {
+          sumPeak = abs(sum);
+        }
+        addSample(plain, plainMix, (sample0 + sample1) / 4.0);
+        addSample(softClip, softMix, sum * slope);
+      }
+    }
+
+    printf("| %3u | %4u | %5.1f | %5.1f | %5.1f | %5.2f%% | %5.1f | %5.1f | %5.2f%% |\n", volume, amount,
+           dBFS(sumPeak, 256),
+           dBFS(plain.peak, 128), dBFS(rms(plain), 128), thdPercent(plain),
+           dBFS(softClip.peak, 128), dBFS(rms(softClip), 128), thdPercent(softClip));
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  static const uint8_t volumes[] = {255, 192, 128, 64};
+
+  uint8_t     note    = argc > 1 ? atoi(argv[1]) : 48;
+  double      slope   = softClipSlope();
+  MutatingFM  voices[2];
+
+  for (uint8_t v = 0; v < 2; v++)
+  {
+    voices[v].setParam(SYNTH_PARAMETER_MOD_RATIO, 300);
+    voices[v].setParam(SYNTH_PARAMETER_MOD_AMOUNT_LFODEPTH, 0);
+    voices[v].setParam(SYNTH_PARAMETER_ENVELOPE_DECAY, 1023);
+  }
+
+  printf("## voice mix levels (dBFS) & added THD - notes %u & %u, soft clip slope %.3f\n\n", note, note + 7, slope);
+  printf("| volume | mod amount | sum peak | plain peak | plain RMS | plain THD | soft clip peak | soft clip RMS | soft clip THD |\n");
+  printf("|------|------|------|------|------|------|------|------|------|\n");
+
+  if (argc > 2)
+  {
+    measureVolume(voices, note, atoi(argv[2]), slope);
+  }
+  else
+  {
+    for (uint8_t i = 0; i < sizeof(volumes); i++)
+    {
+      measureVolume(voices, note, volumes[i], slope);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,533 @@
+/*----------------------------------------------------------------------------------------------------------
+ * wavetableGen.cpp
+ *
+ * Wavetable generator:  writes the int8 wavetable headers in src/ from a spec file, and reports the flash
+ * each table costs.  Run by host/wavetables.py before each firmware build, or by hand.
+ *
+ * Each line of the spec describes one table:
+ *
+ *    name  cells  source [arguments]   # description
+ *
+ *    name          header is name_int8.h, with NAME_DATA, NAME_NUM_CELLS & NAME_SAMPLERATE
+ *                  for bandlimited, NAME_DATA is [L][cells] and NAME_LEVELS is L
+ *    cells         table length.  tables used by the FM oscillators must match SIN2048_NUM_CELLS
+ *    source        formula sine | saw | revsaw | triangle | zero
+ *                  formula square [duty 0-1, default 0.5]
+ *                  formula noise [seed]          - uniform white noise from xorshift32
+ *                  harmonics a1 a2 a3 ...        - sum of sine harmonics with these amplitudes, scaled to full range
+ *                  bandlimited saw|square H L    - L band-limited tables, for an oscillator to pick by pitch:  
+ *                                                  table n has H >> n harmonics (at least 1, at most cells/2 - 1)
+ *                  wav file.wav                  - a single cycle from an 8 or 16 bit PCM WAV, resampled to the
+ *                                                  table length.  the path is relative to the spec file
+ *    description   used in the header's comment
+ *
+ * Blank lines & lines starting with # are ignored.
+ *
+ * usage:  program [-o directory] [-n] spec.txt
+ *    -o, --output DIR    where to write the headers (default src)
+ *    -n, --dry-run       print the flash report without writing the headers
+ *
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ *
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <getopt.h>
+
+#define MAX_LINE_LENGTH     1024
+#define MAX_NAME_LENGTH     64
+#define MAX_TABLE_CELLS     8192
+#define MAX_ARGUMENTS       64
+#define MAX_WAV_SAMPLES     (1 << 20)
+#define MAX_LEVELS          16
+#define DEFAULT_NOISE_SEED  2463534242UL
+
+
+struct TableSpec
+{
+  char    name[MAX_NAME_LENGTH];
+  int     cells;
+  char    source[MAX_NAME_LENGTH];
+  char*   arguments[MAX_ARGUMENTS];
+  int     argumentCount;
+  char    description[MAX_LINE_LENGTH];
+  int     levels;                         // number of tables:  1, or L for bandlimited
+  char    definition[MAX_LINE_LENGTH];    // the source & arguments as written, for the header comment
+};
+
+
+static int clampSample(double value)
+{
+  int sample = (int)floor(value + 0.5);
+  return sample < -128 ? -128 : (sample > 127 ? 127 : sample);
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * generateFormula
+ * revsaw & saw match the tables that used to be checked in:  127.5 - 255 * phase rounded down, with exact 
+ * halves rounded down too, and its mirror image
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool generateFormula(const TableSpec& spec, int8_t* table)
+{
+  const char* formula = spec.argumentCount > 0 ? spec.arguments[0] : "";
+  uint32_t    random  = spec.argumentCount > 1 ? strtoul(spec.arguments[1], NULL, 10) : DEFAULT_NOISE_SEED;
+  double      duty    = spec.argumentCount > 1 ? atof(spec.arguments[1]) : 0.5;
+
+  for (int i = 0; i < spec.cells; i++)
+  {
+    double  phase   = (double)i / spec.cells;
+    int     revsaw  = (int)ceil(127.5 - 255.0 * phase) - 1;
+
+    if      (strcmp(formula, "sine") == 0)      table[i] = clampSample(127.0 * sin(2.0 * M_PI * phase));
+    else if (strcmp(formula, "revsaw") == 0)    table[i] = revsaw;
+    else if (strcmp(formula, "saw") == 0)       table[i] = -1 - revsaw;
+    else if (strcmp(formula, "triangle") == 0)  table[i] = clampSample(phase < 0.5 ? -127.5 + 510.0 * phase : 382.5 - 510.0 * phase);
+    else if (strcmp(formula, "square") == 0)    table[i] = phase < duty ? 127 : -128;
+    else if (strcmp(formula, "zero") == 0)      table[i] = 0;
+    else if (strcmp(formula, "noise") == 0)
+    {
+      random ^= random << 13;
+      random ^= random >> 17;
+      random ^= random << 5;
+      table[i] = (int)(random >> 24) - 128;
+    }
+    else
+    {
+      fprintf(stderr, "%s: unknown formula '%s'\n", spec.name, formula);
+      return false;
+    }
+  }
+  return true;
+}
+
+
+// sums sine harmonics 1 to count with the given amplitudes, scaled so the peak is 127
+static void sumHarmonics(int cells, const double* amplitudes, int count, int8_t* table)
+{
+  double  values[MAX_TABLE_CELLS];
+  double  peak = 0;
+
+  for (int i = 0; i < cells; i++)
+  {
+    values[i] = 0;
+    for (int h = 0; h < count; h++)
+    {
+      values[i] += amplitudes[h] * sin(2.0 * M_PI * (h + 1) * i / cells);
+    }
+    if (fabs(values[i]) > peak) peak = fabs(values[i]);
+  }
+
+  for (int i = 0; i < cells; i++)
+  {
+    table[i] = peak > 0 ? clampSample(values[i] * 127.0 / peak) : 0;
+  }
+}
+
+
+static bool generateHarmonics(const TableSpec& spec, int8_t* table)
+{
+  double amplitudes[MAX_ARGUMENTS];
+
+  if (spec.argumentCount == 0)
+  {
+    fprintf(stderr, "%s: no harmonic amplitudes\n", spec.name);
+    return false;
+  }
+
+  for (int h = 0; h < spec.argumentCount; h++)
+  {
+    amplitudes[h] = atof(spec.arguments[h]);
+  }
+  sumHarmonics(spec.cells, amplitudes, spec.argumentCount, table);
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * generateBandLimited
+ * Fourier series of the saw (rising from -128, as the Mozzi table) or square (high for the first half, as 
+ * the old square table), truncated to fewer harmonics in each table so higher notes stay under Nyquist
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool generateBandLimited(TableSpec* spec, int8_t tables[][MAX_TABLE_CELLS])
+{
+  double  amplitudes[MAX_TABLE_CELLS / 2];
+  bool    square    = spec->argumentCount > 0 && strcmp(spec->arguments[0], "square") == 0;
+  int     harmonics = spec->argumentCount > 1 ? atoi(spec->arguments[1]) : 0;
+
+  spec->levels = spec->argumentCount > 2 ? atoi(spec->arguments[2]) : 0;
+
+  if (spec->argumentCount < 3 || (!square && strcmp(spec->arguments[0], "saw") != 0) || harmonics < 1 
+      || spec->levels < 1 || spec->levels > MAX_LEVELS || spec->cells < 4)
+  {
+    fprintf(stderr, "%s: expected bandlimited saw|square harmonics levels (1-%d)\n", spec->name, MAX_LEVELS);
+    return false;
+  }
+
+  for (int level = 0; level < spec->levels; level++)
+  {
+    int count = harmonics >> level;
+
+    if (count < 1)                   count = 1;
+    if (count > spec->cells / 2 - 1) count = spec->cells / 2 - 1;
+
+    for (int h = 1; h <= count; h++)
+    {
+      amplitudes[h - 1] = square ? ((h & 1) ? 1.0 / h : 0) : -1.0 / h;
+    }
+    sumHarmonics(spec->cells, amplitudes, count, tables[level]);
+  }
+  return true;
+}
+
+
+static uint32_t readLittleEndian(const uint8_t* bytes, int count)
+{
+  uint32_t value = 0;
+
+  for (int i = count - 1; i >= 0; i--)
+  {
+    value = (value << 8) | bytes[i];
+  }
+  return value;
+}
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * generateFromWav
+ * reads the first channel of a PCM WAV file as one cycle.  a file with exactly the table's length is copied 
+ * (16 bit samples are rounded to 8 bits), otherwise it is resampled with linear interpolation
+ *----------------------------------------------------------------------------------------------------------
+ */
+static bool generateFromWav(const TableSpec& spec, const char* specDirectory, int8_t* table)
+{
+  char      path[MAX_LINE_LENGTH];
+  FILE*     file;
+  uint8_t*  data;
+  long      size;
+  long      position      = 12;
+  int       channels      = 0;
+  int       bitsPerSample = 0;
+  uint8_t*  samples       = NULL;
+  long      sampleCount   = 0;
+  double*   values;
+
+  if (spec.argumentCount == 0)
+  {
+    fprintf(stderr, "%s: no WAV file given\n", spec.name);
+    return false;
+  }
+
+  snprintf(path, sizeof(path), "%s%s", spec.arguments[0][0] == '/' ? "" : specDirectory, spec.arguments[0]);
+
+  if (!(file = fopen(path, "rb")))
+  {
+    fprintf(stderr, "%s: can't open %s\n", spec.name, path);
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  data = (uint8_t*)malloc(size);
+  if (!data || fread(data, 1, size, file) != (size_t)size || size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4))
+  {
+    fprintf(stderr, "%s: %s isn't a WAV file\n", spec.name, path);
+    fclose(file);
+    free(data);
+    return false;
+  }
+  fclose(file);
+
+  // walk the chunks for the format & data
+  while (position + 8 <= size)
+  {
+    uint32_t chunkSize = readLittleEndian(data + position + 4, 4);
+
+    if (memcmp(data + position, "fmt ", 4) == 0 && chunkSize >= 16)
+    {
+      if (readLittleEndian(data + position + 8, 2) != 1)
+      {
+        fprintf(stderr, "%s: %s isn't PCM\n", spec.name, path);
+        free(data);
+        return false;
+      }
+      channels      = readLittleEndian(data + position + 10, 2);
+      bitsPerSample = readLittleEndian(data + position + 22, 2);
+    }
+    else if (memcmp(data + position, "data", 4) == 0)
+    {
+      samples     = data + position + 8;
+      sampleCount = ((long)chunkSize < size - position - 8 ? (long)chunkSize : size - position - 8);
+    }
+    position += 8 + chunkSize + (chunkSize & 1);
+  }
+
+  if (!samples || channels < 1 || (bitsPerSample != 8 && bitsPerSample != 16))
+  {
+    fprintf(stderr, "%s: %s must be 8 or 16 bit PCM\n", spec.name, path);
+    free(data);
+    return false;
+  }
+
+  sampleCount /= channels * (bitsPerSample / 8);
+  if (sampleCount < 1 || sampleCount > MAX_WAV_SAMPLES)
+  {
+    fprintf(stderr, "%s: %s has %ld samples\n", spec.name, path, sampleCount);
+    free(data);
+    return false;
+  }
+
+  // first channel as 8 bit values, with 16 bit fractions kept for resampling
+  values = (double*)malloc(sampleCount * sizeof(double));
+  for (long i = 0; i < sampleCount; i++)
+  {
+    const uint8_t* sample = samples + i * channels * (bitsPerSample / 8);
+    values[i] = (bitsPerSample == 8) ? (double)sample[0] - 128 : (int16_t)readLittleEndian(sample, 2) / 256.0;
+  }
+
+  for (int i = 0; i < spec.cells; i++)
+  {
+    double  position  = (double)i * sampleCount / spec.cells;
+    long    index     = (long)position;
+    double  fraction  = position - index;
+
+    table[i] = clampSample(values[index] + (values[(index + 1) % sampleCount] - values[index]) * fraction);
+  }
+
+  free(values);
+  free(data);
+  return true;
+}
+
+
+static bool parseSpecLine(char* line, TableSpec* spec)
+{
+  char* comment = strchr(line, '#');
+  char* token;
+  char* definition;
+
+  spec->description[0] = 0;
+  spec->levels         = 1;
+  if (comment)
+  {
+    *comment = 0;
+    for (comment++; isspace((unsigned char)*comment); comment++);
+    snprintf(spec->description, sizeof(spec->description), "%s", comment);
+  }
+
+  if (!(token = strtok(line, " \t")))
+  {
+    return false;
+  }
+  snprintf(spec->name, sizeof(spec->name), "%s", token);
+
+  spec->cells = (token = strtok(NULL, " \t")) ? atoi(token) : 0;
+
+  if (!(token = strtok(NULL, " \t")))
+  {
+    spec->source[0] = 0;
+    return true;
+  }
+  snprintf(spec->source, sizeof(spec->source), "%s", token);
+
+  definition = spec->definition;
+  definition += sprintf(definition, "%s", spec->source);
+  spec->argumentCount = 0;
+  while ((token = strtok(NULL, " \t")) && spec->argumentCount < MAX_ARGUMENTS)
+  {
+    spec->arguments[spec->argumentCount++] = token;
+    if (definition - spec->definition + strlen(token) + 2 < sizeof(spec->definition))
+    {
+      definition += sprintf(definition, " %s", token);
+    }
+  }
+  return true;
+}
+
+
+static bool writeHeader(const TableSpec& spec, const char* specFile, const char* outputDirectory, int8_t tables[][MAX_TABLE_CELLS])
+{
+  char  path[MAX_LINE_LENGTH];
+  char  upperName[MAX_NAME_LENGTH];
+  FILE* file;
+
+  for (int i = 0; i < MAX_NAME_LENGTH; i++)
+  {
+    upperName[i] = toupper((unsigned char)spec.name[i]);
+  }
+
+  snprintf(path, sizeof(path), "%s/%s_int8.h", outputDirectory, spec.name);
+  if (!(file = fopen(path, "w")))
+  {
+    fprintf(stderr, "can't create %s\n", path);
+    return false;
+  }
+
+  fprintf(file, "/*\n");
+  fprintf(file, "  %s_int8.h - %s\n\n", spec.name, spec.description[0] ? spec.description : "wavetable");
+  fprintf(file, "  generated by host/wavetableGen.cpp from %s:  %s\n", specFile, spec.definition);
+  fprintf(file, "  edit the spec & regenerate rather than editing this file\n");
+  fprintf(file, "*/\n");
+  fprintf(file, "#ifndef %s_H_\n", upperName);
+  fprintf(file, "#define %s_H_\n\n", upperName);
+  fprintf(file, "#if ARDUINO >= 100\n #include \"Arduino.h\"\n#else\n #include \"WProgram.h\"\n#endif\n");
+  fprintf(file, "#include \"mozzi_pgmspace.h\"\n\n");
+  fprintf(file, "#define %s_NUM_CELLS %d\n", upperName, spec.cells);
+  fprintf(file, "#define %s_SAMPLERATE %d\n", upperName, spec.cells);
+  if (spec.levels > 1)
+  {
+    fprintf(file, "#define %s_LEVELS %d\n", upperName, spec.levels);
+  }
+  fprintf(file, "\n/** @ingroup tables\n%s table\n*/\n\n", spec.name);
+
+  if (spec.levels > 1)
+  {
+    fprintf(file, "CONSTTABLE_STORAGE(int8_t) %s_DATA [%d][%d]  =\n        {", upperName, spec.levels, spec.cells);
+  }
+  else
+  {
+    fprintf(file, "CONSTTABLE_STORAGE(int8_t) %s_DATA [%d]  =\n        {", upperName, spec.cells);
+  }
+
+  for (int level = 0; level < spec.levels; level++)
+  {
+    const int8_t* table = tables[level];
+
+    if (spec.levels > 1)
+    {
+      fprintf(file, "%s{", level == 0 ? "\n          " : "\n          ,");
+    }
+    for (int i = 0; i < spec.cells; i++)
+    {
+      fprintf(file, "%s%d", i == 0 ? "\n            " : (i % 16 == 0 ? "\n            ," : ","), table[i]);
+    }
+    if (spec.levels > 1)
+    {
+      fprintf(file, "\n          }");
+    }
+  }
+  fprintf(file, "\n        };\n\n\n");
+  fprintf(file, "#endif /* %s_H_ */\n", upperName);
+
+  fclose(file);
+  return true;
+}
+
+
+static void printUsage(const char* program)
+{
+  fprintf(stderr, "usage: %s [-o directory] [-n] spec.txt\n", program);
+}
+
+
+int main(int argc, char** argv)
+{
+  const char* outputDirectory = "src";
+  const char* specFile;
+  char        specDirectory[MAX_LINE_LENGTH];
+  char        line[MAX_LINE_LENGTH];
+  bool        dryRun          = false;
+  long        totalBytes      = 0;
+  int         lineNumber      = 0;
+  int         option;
+  FILE*       file;
+
+  static const struct option longOptions[] =
+  {
+    {"output",  required_argument, 0, 'o'},
+    {"dry-run", no_argument,       0, 'n'},
+    {0, 0, 0, 0}
+  };
+
+  while ((option = getopt_long(argc, argv, "o:n", longOptions, NULL)) != -1)
+  {
+    switch (option)
+    {
+      case 'o': outputDirectory = optarg; break;
+      case 'n': dryRun          = true;   break;
+      default:
+        printUsage(argv[0]);
+        return 1;
+    }
+  }
+
+  if (optind != argc - 1)
+  {
+    printUsage(argv[0]);
+    return 1;
+  }
+  specFile = argv[optind];
+
+  snprintf(specDirectory, sizeof(specDirectory), "%s", specFile);
+  if (strrchr(specDirectory, '/'))
+  {
+    strrchr(specDirectory, '/')[1] = 0;
+  }
+  else
+  {
+    specDirectory[0] = 0;
+  }
+
+  if (!(file = fopen(specFile, "r")))
+  {
+    fprintf(stderr, "can't open %s\n", specFile);
+    return 1;
+  }
+
+  printf("| table | cells | source | flash (bytes) |\n");
+  printf("|-------|-------|--------|-------|\n");
+
+  while (fgets(line, sizeof(line), file))
+  {
+    static int8_t tables[MAX_LEVELS][MAX_TABLE_CELLS];
+    TableSpec     spec;
+    bool          ok;
+
+    lineNumber++;
+    line[strcspn(line, "\r\n")] = 0;
+
+    if (line[strspn(line, " \t")] == '#' || !parseSpecLine(line, &spec))
+    {
+      continue;
+    }
+
+    if (spec.cells < 1 || spec.cells > MAX_TABLE_CELLS || !spec.source[0])
+    {
+      fprintf(stderr, "%s line %d: expected name, cells (1-%d) and source\n", specFile, lineNumber, MAX_TABLE_CELLS);
+      fclose(file);
+      return 1;
+    }
+
+    if      (strcmp(spec.source, "formula") == 0)     ok = generateFormula(spec, tables[0]);
+    else if (strcmp(spec.source, "harmonics") == 0)   ok = generateHarmonics(spec, tables[0]);
+    else if (strcmp(spec.source, "bandlimited") == 0) ok = generateBandLimited(&spec, tables);
+    else if (strcmp(spec.source, "wav") == 0)         ok = generateFromWav(spec, specDirectory, tables[0]);
+    else
+    {
+      fprintf(stderr, "%s line %d: unknown source '%s'\n", specFile, lineNumber, spec.source);
+      ok = false;
+    }
+
+    if (!ok || (!dryRun && !writeHeader(spec, specFile, outputDirectory, tables)))
+    {
+      fclose(file);
+      return 1;
+    }
+
+    printf("| %s | %d x %d | %s | %d |\n", spec.name, spec.cells, spec.levels, spec.definition, spec.cells * spec.levels);
+    totalBytes += spec.cells * spec.levels;
+  }
+  fclose(file);
+
+  printf("\ntotal %ld bytes of flash (int8 tables cost 1 byte per cell)\n", totalBytes);
+  return 0;
+}
@@ -0,0 +1,58 @@
+#----------------------------------------------------------------------------------------------------------
+# wavetables.py
+#
+# PlatformIO pre-build script:  regenerates the wavetable headers in src/ from host/wavetables/wavetables.txt
+# when the spec, a WAV it reads or the generator is newer than the headers.  Builds host/wavetableGen.cpp
+# with the host's C++ compiler.  If there's no compiler the checked-in headers are used as they are, so
+# Arduino IDE builds (which don't run this) & machines without a host toolchain still build.
+#----------------------------------------------------------------------------------------------------------
+import os
+import shutil
+import subprocess
+
+Import("env")
+
+projectDir  = env.subst("$PROJECT_DIR")
+specFile    = os.path.join(projectDir, "host", "wavetables", "wavetables.txt")
+generator   = os.path.join(projectDir, "host", "wavetableGen.cpp")
+sourceDir   = os.path.join(projectDir, "src")
+buildDir    = os.path.join(projectDir, ".pio", "wavetables")
+program     = os.path.join(buildDir, "wavetableGen")
+
+
+def tableHeaders():
+    headers = []
+    with open(specFile) as spec:
+        for line in spec:
+            fields = line.split("#")[0].split()
+            if fields:
+                headers.append(os.path.join(sourceDir, fields[0] + "_int8.h"))
+    return headers
+
+
+def tableInputs():
+    inputs = [specFile, generator]
+    with open(specFile) as spec:
+        for line in spec:
+            fields = line.split("#")[0].split()
+            if len(fields) > 3 and fields[2] == "wav":
+                inputs.append(os.path.join(os.path.dirname(specFile), fields[3]))
+    return inputs
+
+
+def isOutOfDate():
+    headers = tableHeaders()
+    if not all(os.path.exists(header) for header in headers):
+        return True
+    newestInput = max(os.path.getmtime(path) for path in tableInputs() if os.path.exists(path))
+    return newestInput > min(os.path.getmtime(header) for header in headers)
+
+
+if isOutOfDate():
+    compiler = shutil.which("c++") or shutil.which("g++") or shutil.which("clang++")
+    if not compiler:
+        print("wavetables: no host C++ compiler, using the checked-in headers")
+    else:
+        os.makedirs(buildDir, exist_ok=True)
+        subprocess.check_call([compiler, "-O2", "-o", program, generator])
+        subprocess.check_call([program, "-o", sourceDir, os.path.relpath(specFile, projectDir)], cwd=projectDir)
@@ -91,8 +91,14 @@
 // MOZZI variables
 // original had at 256 but as CPU got tight had to reduce it
 // needs to be at least 128. 64Hz means incoming sync pulses are regularly missed between updates.
+// replaces Mozzi's default, defined by MozziGuts.h
+#undef  CONTROL_RATE
 #define CONTROL_RATE 128   
 
+#if (AUDIO_RATE >> AUDIO_RAMP_SHIFT) != CONTROL_RATE
+#error "AUDIO_RAMP_SHIFT in avSource.h must match CONTROL_RATE"
+#endif
+
 // todo:  decrease INTERFACE_UPDATE_DIVIDER  if controls are externally modulated via CV voltage inputs
 #define INTERFACE_UPDATE_DIVIDER_ANALOG 5
 #define INTERFACE_UPDATE_DIVIDER_DIGITAL 7
@@ -119,6 +125,11 @@ uint8_t bitsCurrentButton;
 // save space for param lock flags - use a bit rather than a byte per param 
 uint8_t bitsLastParamLock;
 
+#ifdef ENABLE_WAVETABLE_MORPH
+// where Func + mod decay was last left, for when a morph parameter lock ends
+uint16_t morphKnobValue = 0;
+#endif
+
 // time since the last updateAudio()
 uint32_t lastUpdateMicros;
 
@@ -132,7 +143,7 @@ uint8_t updateCounter = 0;
 MutatingFM          voice0;
 
 // voice 2 instance
-MutatingFM          voice1;
+MutatingFM          voice1(FM_OPERATORS_VOICE1);
 
 // array of pointers to the MutatingFM instances to simplfy the code
 MutatingFM*         voices[2];  
@@ -150,6 +161,63 @@ EventDelay          settingDisplayTimer;
 MutatingSequencerMultiTrack sequencer;
 
 
+// function prototypes
+// the Arduino IDE generates these automatically, but other compilers (eg the native host build) need them declared
+void setup();
+void loop();
+void debugPrintMemoryUsage();
+void initialiseDisplay();
+void initialisePins();
+void initialiseSources();
+void initialiseSequencer();
+void updateControl();
+void updateLFOModulationDisplay();
+int  updateSequencer();
+void outputSyncPulse();
+void getParameterLocks();
+inline void     setParameterLock(int8_t paramChannel, uint16_t value);
+inline int8_t   getParameterLockChannel(uint8_t analogControlIndex);
+inline int8_t   getParameterLockControl(uint8_t paramChannelIndex);
+inline uint16_t getParameterLockKnobValue(uint8_t paramChannelIndex);
+inline int8_t   getParameterLockSynthParam(uint8_t paramChannelIndex);
+void updateSyncTrigger();
+inline uint8_t  getLastButtonState(uint8_t buttonIndex);
+inline uint8_t  getCurrentButtonState(uint8_t buttonIndex);
+inline void     setLastButtonState(uint8_t buttonIndex, uint8_t value);
+inline void     setCurrentButtonState(uint8_t buttonIndex, uint8_t value);
+void updateButtonControls();
+void startStopSequencer();
+void updateSynthControl();
+void updateScale();
+void updateAlgorithm();
+inline void updateAnalogControls();
+void updateNoteDecay(bool ignoreRecordMode);
+void updateTonic(int incr);
+uint8_t getMidiNoteIconIndex(uint8_t midinote);
+int  updateAudio();
+inline int mixVoicesSum();
+inline int outputVoiceMix(int16_t mix);
+#ifdef ENABLE_VOICE_MIX_MODES
+int  mixVoicesRing();
+int  mixVoicesAM();
+void setVoiceMixMode(uint8_t mode);
+#endif
+void updateDisplay();
+void displaySequenceLength();
+void displaySettingIcon(const byte* bitmap);
+void displayTonicIcon();
+void debugWriteValue(char* valueName, int value);
+int  scaleAnalogInput(int rawValue, int maxScale);
+long scaleAnalogInputNonLinear(long rawValue, long kneeX, long kneeY, long maxScale);
+bool analogInputHasChanged(byte inputChannel);
+
+#ifdef ENABLE_VOICE_MIX_MODES
+// how the voices are mixed, VOICE_MIX_*, and the kernel updateAudio() calls for it
+uint8_t voiceMixMode = VOICE_MIX_SUM;
+int     (*mixVoices)() = mixVoicesSum;
+#endif
+
+
 
 
 
@@ -280,9 +348,6 @@ void initialisePins()
  */
 void initialiseSources()
 {
-  voice0.setOscillator(0);
-  voice1.setOscillator(1);
-
   voices[0] = &voice0;  
   voices[1] = &voice1;  
 }
@@ -556,7 +621,7 @@ void getParameterLocks()
         Serial.println(iCurrentAnalogValue[getParameterLockControl(paramIndex)]);
         */
         #endif
-        thisParamLock = iCurrentAnalogValue[getParameterLockControl(paramIndex)];
+        thisParamLock = getParameterLockKnobValue(paramIndex);
       }
 
       // reset the lock bitflag for this parameter
@@ -655,11 +720,32 @@ inline int8_t getParameterLockControl(uint8_t paramChannelIndex)
     case PARAM_LOCK_CHANNEL_3: return ANALOG_INPUT_MOD_ENVELOPE1;
     case PARAM_LOCK_CHANNEL_4: return ANALOG_INPUT_MOD_ENVELOPE2;
     case PARAM_LOCK_CHANNEL_5: return ANALOG_INPUT_LFO;
+    #ifdef ENABLE_WAVETABLE_MORPH
+    case PARAM_LOCK_CHANNEL_MORPH: return ANALOG_INPUT_MOD_ENVELOPE1;
+    #endif
     default:  return -1;
   }
 }
 
 
+/*----------------------------------------------------------------------------------------------------------
+ * getParameterLockKnobValue
+ * returns the value to go back to when a parameter lock ends - the knob's position, or for a Func + knob
+ * parameter, where the knob was last left with Func held
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline uint16_t getParameterLockKnobValue(uint8_t paramChannelIndex)
+{
+  #ifdef ENABLE_WAVETABLE_MORPH
+  if (paramChannelIndex == PARAM_LOCK_CHANNEL_MORPH)
+  {
+    return morphKnobValue;
+  }
+  #endif
+  return iCurrentAnalogValue[getParameterLockControl(paramChannelIndex)];
+}
+
+
 /*----------------------------------------------------------------------------------------------------------
  * getParameterLockSynthParam
  * returns the sytnh parameter for a given sequencer modulation channel 
@@ -675,6 +761,9 @@ inline int8_t getParameterLockSynthParam(uint8_t paramChannelIndex)
     case PARAM_LOCK_CHANNEL_3: return SYNTH_PARAMETER_ENVELOPE_DECAY;
     case PARAM_LOCK_CHANNEL_4: return SYNTH_PARAMETER_ENVELOPE_ATTACK;
     case PARAM_LOCK_CHANNEL_5: return SYNTH_PARAMETER_MOD_AMOUNT_LFODEPTH;
+    #ifdef ENABLE_WAVETABLE_MORPH
+    case PARAM_LOCK_CHANNEL_MORPH: return SYNTH_PARAMETER_CARRIER_MORPH;
+    #endif
     default:  return SYNTH_PARAMETER_UNKNOWN;
   }
 }
@@ -853,6 +942,15 @@ void updateButtonControls()
       case INTERFACE_MODE_NORMAL:   
         if (getCurrentButtonState(BUTTON_INPUT_VOICE) == HIGH)
         {
+          #ifdef ENABLE_VOICE_MIX_MODES
+          if (getCurrentButtonState(BUTTON_INPUT_REC) == HIGH)
+          {
+            // if user is holding down REC when they hit VOICE, then change how the voices are mixed
+            setVoiceMixMode((voiceMixMode + 1) % MAX_VOICE_MIX_MODES);
+            displaySettingIcon(BITMAP_NUMERALS[voiceMixMode]);
+            break;
+          }
+          #endif
           updateSynthControl();
         }
         break;
@@ -1091,7 +1189,6 @@ inline void updateAnalogControls()
 
             case INTERFACE_MODE_SHIFT:  
               // shift-decay = volume of voice, so each part can be different volume (or off)
-              // currently MutatingFM.setGain() does nothing
               // setGain range 0-255
               voices[controlSynthVoice]->setGain(iCurrentAnalogValue[ANALOG_INPUT_DECAY] >> 2);
 
@@ -1108,9 +1205,20 @@ inline void updateAnalogControls()
               voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_MOD_AMOUNT, iCurrentAnalogValue[ANALOG_INPUT_MOD_AMOUNT]);
               break;
             case INTERFACE_MODE_SHIFT:  
+              #if FM_OPERATORS > 2
+              // shift-depth = modulation amount of the extra operators
+              voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_OPERATOR_AMOUNT, iCurrentAnalogValue[ANALOG_INPUT_MOD_AMOUNT]);
+              #else
               voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_MOD_AMOUNT, iCurrentAnalogValue[ANALOG_INPUT_MOD_AMOUNT]);
+              #endif
               break;
           }
+          #if FM_OPERATORS > 2
+          if (interfaceMode == INTERFACE_MODE_SHIFT)
+          {
+            break;
+          }
+          #endif
           setParameterLock(getParameterLockChannel(ANALOG_INPUT_MOD_AMOUNT), iCurrentAnalogValue[ANALOG_INPUT_MOD_AMOUNT]);
 
          break;
@@ -1125,9 +1233,24 @@ inline void updateAnalogControls()
               break;
 
             case INTERFACE_MODE_SHIFT:  
+              // the options below can't be combined (see avSource.h), so each has shift-ratio to itself
+              #if FM_OPERATORS > 2
+              // shift-ratio = frequency ratio of the extra operators
+              voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_OPERATOR_RATIO, iCurrentAnalogValue[ANALOG_INPUT_MOD_RATIO]);
+              #elif defined(ENABLE_MODULATOR_FEEDBACK)
+              // shift-ratio = modulator self-feedback
+              voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_MODULATOR_FEEDBACK, iCurrentAnalogValue[ANALOG_INPUT_MOD_RATIO]);
+              #else
               voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_MOD_RATIO, iCurrentAnalogValue[ANALOG_INPUT_MOD_RATIO]);
+              #endif
               break;
           }
+          #if defined(ENABLE_MODULATOR_FEEDBACK) || FM_OPERATORS > 2
+          if (interfaceMode == INTERFACE_MODE_SHIFT)
+          {
+            break;
+          }
+          #endif
           setParameterLock(getParameterLockChannel(ANALOG_INPUT_MOD_RATIO), iCurrentAnalogValue[ANALOG_INPUT_MOD_RATIO]);
           
          break;
@@ -1187,9 +1310,22 @@ inline void updateAnalogControls()
               voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_ENVELOPE_DECAY, iCurrentAnalogValue[ANALOG_INPUT_MOD_ENVELOPE1]);
               break;
             case INTERFACE_MODE_SHIFT:  
+              #ifdef ENABLE_WAVETABLE_MORPH
+              // shift-decay = carrier morph, recorded on its own parameter lock channel
+              morphKnobValue = iCurrentAnalogValue[ANALOG_INPUT_MOD_ENVELOPE1];
+              voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_CARRIER_MORPH, morphKnobValue);
+              setParameterLock(PARAM_LOCK_CHANNEL_MORPH, morphKnobValue);
+              #else
               //todo: shift function for decay knob
+              #endif
               break;
           }
+          #ifdef ENABLE_WAVETABLE_MORPH
+          if (interfaceMode == INTERFACE_MODE_SHIFT)
+          {
+            break;
+          }
+          #endif
           setParameterLock(getParameterLockChannel(ANALOG_INPUT_MOD_ENVELOPE1), iCurrentAnalogValue[ANALOG_INPUT_MOD_ENVELOPE1]);
           
           break;
@@ -1203,9 +1339,20 @@ inline void updateAnalogControls()
               voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_ENVELOPE_ATTACK, iCurrentAnalogValue[ANALOG_INPUT_MOD_ENVELOPE2]);
               break;
             case INTERFACE_MODE_SHIFT:  
+              #ifdef ENABLE_WAVETABLE_MORPH
+              // shift-attack = how far the LFO moves the carrier morph
+              voices[controlSynthVoice]->setParam(SYNTH_PARAMETER_CARRIER_MORPH_LFODEPTH, iCurrentAnalogValue[ANALOG_INPUT_MOD_ENVELOPE2]);
+              #else
               //todo: shift function for attack knob
+              #endif
               break;
           }
+          #ifdef ENABLE_WAVETABLE_MORPH
+          if (interfaceMode == INTERFACE_MODE_SHIFT)
+          {
+            break;
+          }
+          #endif
           setParameterLock(getParameterLockChannel(ANALOG_INPUT_MOD_ENVELOPE2), iCurrentAnalogValue[ANALOG_INPUT_MOD_ENVELOPE2]);
           
           break;
@@ -1295,13 +1442,112 @@ uint8_t getMidiNoteIconIndex(uint8_t midinote)
 /*----------------------------------------------------------------------------------------------------------
  * updateAudio
  * returns the current source audio to be output on pin 9
- * mixes the two voices together with simple addition
+ * with ENABLE_VOICE_MIX_MODES, from the mix kernel chosen by setVoiceMixMode(), otherwise the voices summed
  *----------------------------------------------------------------------------------------------------------
  */
 int updateAudio()
 {
-  return MonoOutput::fromNBit(9, voices[0]->updateAudio() + voices[1]->updateAudio());
+  #ifdef ENABLE_VOICE_MIX_MODES
+  return mixVoices();
+  #else
+  return mixVoicesSum();
+  #endif
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * outputVoiceMix
+ * scales a 9 bit mix of the voices to the output:  through the saturation curve with ENABLE_SOFT_CLIP_MIXER, 
+ * otherwise halved like the sum of the two voices' updateAudio()
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int outputVoiceMix(int16_t mix)
+{
+  #ifdef ENABLE_SOFT_CLIP_MIXER
+  return MonoOutput::fromNBit(8, softClipVoiceMix(mix));
+  #else
+  return MonoOutput::fromNBit(9, mix >> 1);
+  #endif
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * mixVoicesSum
+ * mixes the two voices together with simple addition
+ * calls the voice objects directly rather than through voices[] so the FM code is inlined here
+ * ENABLE_FUSED_VOICE_KERNEL computes both voices in one pass, see MutantFMSynthOptions.h
+ * ENABLE_SOFT_CLIP_MIXER saturates the top 9 bits of the sum instead
+ * with FM_OPERATORS, voice1 only gets the extra operators if FM_OPERATOR_VOICES is 2
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int mixVoicesSum()
+{
+  #if defined(ENABLE_SOFT_CLIP_MIXER)
+  return outputVoiceMix((voice0.nextSample<FM_OPERATORS_VOICE0>() + voice1.nextSample<FM_OPERATORS_VOICE1>()));
+  #elif defined(ENABLE_FUSED_VOICE_KERNEL)
+  return MutatingFM::updateAudioPair<FM_OPERATORS_VOICE0, FM_OPERATORS_VOICE1>(voice0, voice1);
+  #else
+  return MonoOutput::fromNBit(9, voice0.updateAudio<FM_OPERATORS_VOICE0>() + voice1.updateAudio<FM_OPERATORS_VOICE1>());
+  #endif
+}
+
+
+
+#ifdef ENABLE_VOICE_MIX_MODES
+/*----------------------------------------------------------------------------------------------------------
+ * mixVoicesRing
+ * ring modulation:  the product of the two voices, each taken down to 8 bits so it's an 8x8 multiply
+ * scaled to the same full scale as mixVoicesSum()
+ *----------------------------------------------------------------------------------------------------------
+ */
+int mixVoicesRing()
+{
+  int8_t  sample0 = voice0.nextSample<FM_OPERATORS_VOICE0>();
+  int8_t  sample1 = voice1.nextSample<FM_OPERATORS_VOICE1>();
+  int16_t mix     = ((int16_t)sample0 * sample1) >> 6;
+
+  // -128 * -128 is the only product past 9 bits
+  return outputVoiceMix(mix > 255 ? 255 : mix);
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * mixVoicesAM
+ * amplitude modulation:  track 2's voice with its level set by track 1's, offset to 0-255
+ * silent when voice 0 is at its lowest and voice 1 at full level at its highest, the full scale of mixVoicesSum()
+ *----------------------------------------------------------------------------------------------------------
+ */
+int mixVoicesAM()
+{
+  int8_t sample0 = voice0.nextSample<FM_OPERATORS_VOICE0>();
+  int8_t sample1 = voice1.nextSample<FM_OPERATORS_VOICE1>();
+
+  // int8 * uint8 fits in 16 bits
+  return outputVoiceMix((sample1 * (uint8_t)(sample0 + 128)) >> 7);
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * setVoiceMixMode
+ * selects VOICE_MIX_* by pointing mixVoices at its kernel, so updateAudio() doesn't test the mode each sample
+ *----------------------------------------------------------------------------------------------------------
+ */
+void setVoiceMixMode(uint8_t mode)
+{
+  voiceMixMode = mode % MAX_VOICE_MIX_MODES;
+
+  switch (voiceMixMode)
+  {
+    case VOICE_MIX_RING:  mixVoices = mixVoicesRing;  break;
+    case VOICE_MIX_AM:    mixVoices = mixVoicesAM;    break;
+    default:              mixVoices = mixVoicesSum;   break;
+  }
 }
+#endif
 
 
 
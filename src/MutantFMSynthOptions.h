@@ -14,11 +14,130 @@
 
 
 
-// 09 May 2022
-// added compile options to reduce compiled image size to fit into boards with larger bootloaders, or using different compilers such as Arduino IDE
-// uncomment the below to reduce the image size by 2KB
+// options marked EXPERIMENTAL haven't had their cost on a Nano measured yet.  before relying on one, check it fits 
+// the 976-cycle budget with host/bench/avrCycleBench.sh & its bench_avr_* env
+
+
+
+
+// compile option for the two-voice audio path
+// uncomment the below to compute both voices in one fused kernel (MutatingFM::updateAudioPair) instead of
+// two calls to MutatingFM::updateAudio().  output is bit-identical - check with host/renderCompare.sh render_fused.
+// can't be used with ENABLE_SOFT_CLIP_MIXER
+
+//#define ENABLE_FUSED_VOICE_KERNEL
+
+
+
+
+// compile option for smoother envelopes
+// gain & modulation amount are calculated at CONTROL_RATE and normally held for the whole control period, which 
+// steps audibly on fast attack/decay settings.  uncomment the below to ramp linearly between control ticks at 
+// audio rate instead - costs a 16 and a 32 bit add per voice per sample, and delays the envelopes by one tick
+
+//#define ENABLE_AUDIO_RATE_RAMPS
+
+
+
+
+// compile option for a cheaper FM multiply
+// uncomment the below to round the modulation amount to 16 bits once per control tick so the audio path does a 
+// 16x8 multiply instead of 32x8.  the carrier phase offset changes by at most 2 table cells (of 2048), see 
+// host/modIndexError.cpp for the error analysis
+
+//#define ENABLE_16BIT_MODULATION_INDEX
+
+
+
+
+// compile option for alternative tunings
+// uncomment the below to replace equal temperament with a tuning header made from a Scala .scl/.kbm file by 
+// host/sclToHeader.cpp (see src/tuning.h).  the sequencer's scales are converted to the nearest notes of the tuning, 
+// so tunings with more or fewer than 12 notes per octave work too.  MIDI output sends the tuning's note numbers
+
+//#define TUNING_HEADER "tuning_19edo_uint32.h"
+
+
+
+
+// compile option for smaller wavetables - EXPERIMENTAL
+// uncomment the below to read 256 or 512-cell tables with linear interpolation instead of the 2048-cell tables, so 
+// each waveform takes 1/8 or 1/4 of the flash.  costs a second table read & a 16x8 multiply per oscillator per sample.  
+// compare the aliasing with host/aliasingCompare.sh aliasing_measure_interp256.  the flash saved holds 10 more 
+// waveforms for the carrier, modulator & LFO (triangle, pulses & harmonic blends - see WAVEFORM_* in avSource.h)
+
+//#define INTERPOLATED_WAVETABLE_CELLS 512
+
+
+
+
+// compile option for band-limited carrier waveforms - needs INTERPOLATED_WAVETABLE_CELLS
+// saw, reverse saw & square carriers alias at high notes.  uncomment the below to play them from tables with fewer 
+// harmonics for each octave, picked by setFreqs() when the note changes so there's no cost per sample.  the tables 
+// take 4KB of flash at 256 cells, 8KB at 512.  see host/aliasingMeasure.cpp
+
+//#define ENABLE_BANDLIMITED_WAVETABLES
+
+
+
+
+// compile option for carrier wavetable morphing - EXPERIMENTAL
+// uncomment the below to crossfade each voice's carrier towards the next waveform in the bank.  Func + mod decay sets 
+// the morph (param-lockable) and Func + mod attack sets how far the LFO moves it.  needs INTERPOLATED_WAVETABLE_CELLS.
+// the morph is quantised to 16 steps and each voice's carrier reads a 256-cell table in RAM holding it, rebuilt at 
+// control rate when the step changes, so there's no extra cost per sample.  the two tables take 512 bytes of RAM
+
+//#define ENABLE_WAVETABLE_MORPH
+
+
+
+
+// compile option for modulator self-feedback
+// uncomment the below to feed the modulator's output back into its own phase, as a DX7's feedback operator does.  
+// Func + ratio sets the amount - a sine modulator goes from pure to saw-like to noise.  costs an add, a shift & an 
+// 8x8 multiply per voice per sample
+
+//#define ENABLE_MODULATOR_FEEDBACK
+
+
+
+
+// compile option for 3 or 4 operator FM
+// uncomment FM_OPERATORS to add 1 or 2 sine operators to the carrier & modulator, routed by FM_ALGORITHM:
+//    FM_ALGORITHM_STACK      each operator modulates the next:  4 -> 3 -> modulator -> carrier
+//    FM_ALGORITHM_PARALLEL   the modulator & the extra operators all modulate the carrier
+//    FM_ALGORITHM_2PLUS2     two 2-operator stacks mixed:  modulator -> carrier + 4 -> 3.  needs 4 operators.  the
+//                            stacks are averaged to stay in 8 bits, so it plays 6dB quieter than the others
+// the extra operators play at the same ratio of the carrier, set with Func + ratio, and follow the modulation 
+// envelope scaled by Func + depth.  each costs a table read & a 16x8 multiply per sample, so on a Nano only track 1's
+// voice gets them - set FM_OPERATOR_VOICES to 2 on faster boards.  can't be used with 
+// ENABLE_MODULATOR_FEEDBACK, which uses Func + ratio too
+
+//#define FM_OPERATORS 4
+//#define FM_ALGORITHM FM_ALGORITHM_STACK
+//#define FM_OPERATOR_VOICES 2
+
+
+
+
+// compile option for ring modulation & AM between the voices
+// uncomment the below to select how the two voices are mixed with [Rec] + Voice:  summed as normal, ring modulated 
+// (multiplied), or track 1's voice modulating the amplitude of track 2's.  each mix is its own kernel, called through 
+// a pointer set when the mode changes, so there's no per-sample switch - ring & AM cost an 8x8 multiply
+
+//#define ENABLE_VOICE_MIX_MODES
+
+
+
+
+// compile option for a soft-clipping voice mix
+// uncomment the below to pass the mix of the two voices through a 512-entry saturation curve (softclip512_int8.h) 
+// instead of halving it.  the mix is 7.6dB louder, using the headroom the halving leaves, & stays linear up to 3/4
+// of full scale, where it rounds off so the loudest sum just reaches full scale.  costs a table read per sample, and
+// the voices are summed separately, so it can't be used with ENABLE_FUSED_VOICE_KERNEL.  measure it with 
+// env:soft_clip_measure
 
-//#define COMPILE_SMALLER_BINARY
+//#define ENABLE_SOFT_CLIP_MIXER
 
 
 
@@ -0,0 +1,96 @@
+/*
+  avInterpolatingOscil.h - a wavetable oscillator for small tables, with linear interpolation between cells
+
+  a stand-in for Mozzi's Oscil, with the parts of its interface the voices use, for builds with
+  INTERPOLATED_WAVETABLE_CELLS set (see MutantFMSynthOptions.h)
+
+  the phase runs over 2048 << 16 per cycle whatever the table size, as it does in a 2048-cell Oscil, so
+  phase increments from the tuning tables, setFreqs() and the noise waveform work unchanged.  the cell is
+  the top bits of the phase and the next 7 bits interpolate towards the following cell
+
+  RAM_TABLE reads a table in RAM rather than PROGMEM, eg the carrier's morph table with ENABLE_WAVETABLE_MORPH
+*/
+
+#ifndef avInterpolatingOscil_h
+#define avInterpolatingOscil_h
+
+#include <mozzi_fixmath.h>
+#include <mozzi_pgmspace.h>
+
+// cells in one cycle of the phase, as in a 2048-cell Oscil
+#define INTERPOLATING_OSCIL_PHASE_CELLS   2048
+#define INTERPOLATING_OSCIL_PHASE_BITS    27
+#define INTERPOLATING_OSCIL_FRACTION_BITS 7
+
+
+template <uint16_t NUM_TABLE_CELLS, uint16_t UPDATE_RATE, bool RAM_TABLE = false>
+class InterpolatingOscil
+{
+  public:
+    InterpolatingOscil(const int8_t* tableData) : table(tableData) {}
+    InterpolatingOscil() {}
+
+    inline int8_t next()
+    {
+      phase += phaseIncrement;
+      return read(phase);
+    }
+
+    inline int8_t phMod(Q15n16 phaseModulation)
+    {
+      phase += phaseIncrement;
+      return read(phase + (uint32_t)phaseModulation * INTERPOLATING_OSCIL_PHASE_CELLS);
+    }
+
+    inline void setTable(const int8_t* tableData)       { table = tableData; }
+    inline void setPhaseFractional(uint32_t newPhase)   { phase = newPhase; }
+    inline uint32_t getPhaseFractional()                { return phase; }
+    inline void setPhaseInc(uint32_t increment)         { phaseIncrement = increment; }
+
+    inline void setFreq(float frequency)
+    {
+      phaseIncrement = (uint32_t)((((float)INTERPOLATING_OSCIL_PHASE_CELLS * frequency) / UPDATE_RATE) * 65536.0f);
+    }
+
+    inline void setFreq_Q16n16(Q16n16 frequency)
+    {
+      phaseIncrement = (uint32_t)(((uint64_t)frequency * INTERPOLATING_OSCIL_PHASE_CELLS) / UPDATE_RATE);
+    }
+
+  private:
+    // bits of the phase below the cell index
+    static constexpr uint8_t cellShift(uint16_t cells)
+    {
+      return cells <= 1 ? INTERPOLATING_OSCIL_PHASE_BITS : cellShift(cells >> 1) - 1;
+    }
+
+    static_assert((NUM_TABLE_CELLS & (NUM_TABLE_CELLS - 1)) == 0 && NUM_TABLE_CELLS >= 64 && NUM_TABLE_CELLS <= INTERPOLATING_OSCIL_PHASE_CELLS,
+                  "InterpolatingOscil tables must be a power of 2 from 64 to 2048 cells");
+
+    /*----------------------------------------------------------------------------------------------------------
+     * read()
+     * returns the table at the phase, interpolated between the two cells either side and rounded
+     * the difference between cells is at most 255, so times a 7 bit fraction it fits in 16 bits
+     *----------------------------------------------------------------------------------------------------------
+     */
+    inline int8_t read(uint32_t readPhase)
+    {
+      uint16_t  cell      = (readPhase >> cellShift(NUM_TABLE_CELLS)) & (NUM_TABLE_CELLS - 1);
+      uint8_t   fraction  = (readPhase >> (cellShift(NUM_TABLE_CELLS) - INTERPOLATING_OSCIL_FRACTION_BITS)) & ((1 << INTERPOLATING_OSCIL_FRACTION_BITS) - 1);
+      int8_t    current   = readCell(cell);
+      int8_t    following = readCell((cell + 1) & (NUM_TABLE_CELLS - 1));
+
+      return current + (((int16_t)(following - current) * fraction + (1 << (INTERPOLATING_OSCIL_FRACTION_BITS - 1))) >> INTERPOLATING_OSCIL_FRACTION_BITS);
+    }
+
+    inline int8_t readCell(uint16_t cell)
+    {
+      return RAM_TABLE ? table[cell] : FLASH_OR_RAM_READ<const int8_t>(table + cell);
+    }
+
+    const int8_t* table;
+    uint32_t      phase;
+    uint32_t      phaseIncrement;
+};
+
+#endif
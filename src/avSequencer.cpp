@@ -11,6 +11,7 @@
 #include <MozziGuts.h>
 
 #include "Arduino.h"
+#include "tuning.h"
 #include "avSequencer.h"
 
 
@@ -47,13 +48,14 @@ MutatingSequencer::MutatingSequencer()
   retrigStep          = 0;     
   retrigState         = false;                        
   tonicNote           = 9;   // default to A
+  tonicStep           = semitonesToTuningSteps(tonicNote);
   octave              = 1;                           
   mutationProbability = 0;
   noteProbability      = 70;
   tonicProbability    = 30;
   sequenceLength      = 16;
   bpm                 = 130;
-  currentNote         = tonicNote;
+  currentNote         = tonicStep;
   nextStepNoteLength  = 80;
   octaveSpread        = 3;  
   scaleNoteCount      = 7;
@@ -305,8 +307,9 @@ void MutatingSequencer::setTonic(int8_t newTonic)
     Serial.println(newTonic);
     #endif
 
-    noteShift = newTonic - tonicNote;
+    noteShift = semitonesToTuningSteps(newTonic) - tonicStep;
     tonicNote = newTonic;
+    tonicStep = tonicStep + noteShift;
     
     // update the whole sequence to the new tonic
     for(int i=0; i< MAX_SEQUENCE_LENGTH; i++)
@@ -340,7 +343,7 @@ void MutatingSequencer::setOctave(int8_t newOctave)
   
   if (newOctave != octave)
   { 
-    noteShift = (newOctave - octave) * 12;
+    noteShift = (newOctave - octave) * TUNING_NOTES_PER_OCTAVE;
     octave = newOctave;
     
     // update the whole sequence to the new tonic
@@ -435,6 +438,12 @@ void MutatingSequencer::initialiseScale(int scaleMode)
 
 
   }
+
+  // scales are defined in semitones - convert them to the nearest notes of the tuning
+  for (uint8_t i = 0; i < scaleNoteCount; i++)
+  {
+    scaleNotes[i] = semitonesToTuningSteps((int8_t)scaleNotes[i]);
+  }
 }
 
 
@@ -607,7 +616,7 @@ void MutatingSequencer::testSequence()
 {
   for (uint8_t i = 0; i < MAX_SEQUENCE_LENGTH; i++)
   {
-    notes[i] = tonicNote + i;
+    notes[i] = tonicStep + i;
   }
 }
 
@@ -628,12 +637,12 @@ void MutatingSequencer::newSequence(byte seqLength)
   for(int i=0; i < sequenceLength; i++)
   { 
                //root     //scale note                        //octave
-    notes[i] = tonicNote + (12*octave) + scaleNotes[rand(scaleNoteCount)] + (12*rand(octaveSpread));
+    notes[i] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + scaleNotes[rand(scaleNoteCount)] + (TUNING_NOTES_PER_OCTAVE*rand(octaveSpread));
 
     //sprinkle the tonic in there with a bit more frequency
     if (rand(100) < tonicProbability) 
     {
-      notes[i] = tonicNote + (12*octave) + (12*rand(octaveSpread));
+      notes[i] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + (TUNING_NOTES_PER_OCTAVE*rand(octaveSpread));
     }
     
     // sprinkle some rests
@@ -688,12 +697,12 @@ void MutatingSequencer::mutateSequenceDefault()
       {
         if (rand(100) < tonicProbability) 
         {
-          notes[seqStep] = tonicNote + (12*octave) + (12*rand(octaveSpread));
+          notes[seqStep] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + (TUNING_NOTES_PER_OCTAVE*rand(octaveSpread));
         }
         else
         {
                         //root        //scale note                        //octave
-          notes[seqStep] = tonicNote + (12*octave) + scaleNotes[rand(scaleNoteCount)] + (12*rand(octaveSpread));
+          notes[seqStep] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + scaleNotes[rand(scaleNoteCount)] + (TUNING_NOTES_PER_OCTAVE*rand(octaveSpread));
         }
         
       }
@@ -748,7 +757,7 @@ void MutatingSequencer::mutateSequenceArp()
       {
         seqStep = (startStep + i) % MAX_SEQUENCE_LENGTH;
         seqNote = scaleNotes[(startNote + (i*stepSize*runDirection) ) % scaleNoteCount];
-        notes[seqStep] = tonicNote + seqNote + (12*(startOctave + (startNote + i < scaleNoteCount ? 0 : 1)));
+        notes[seqStep] = tonicStep + seqNote + (TUNING_NOTES_PER_OCTAVE*(startOctave + (startNote + i < scaleNoteCount ? 0 : 1)));
         #ifndef ENABLE_MIDI_OUTPUT
         Serial.print(notes[seqStep]);
         Serial.print(F(","));
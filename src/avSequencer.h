@@ -12,6 +12,7 @@
 #define avSequencer_h
 
 #include "Arduino.h"
+#include "MutantFMSynthOptions.h"
 #include "avMidi.h"
 #include <EventDelay.h>
 #include <ADSR.h>
@@ -44,7 +45,6 @@
 #define SYNC_STEPS_PER_PULSE 2
 #define SYNC_STEPS_PER_TAP 4
 
-#define MAX_PARAMETER_LOCKS 6
 #define PARAM_LOCK_CHANNEL_0  0
 #define PARAM_LOCK_CHANNEL_1  1
 #define PARAM_LOCK_CHANNEL_2  2
@@ -52,6 +52,14 @@
 #define PARAM_LOCK_CHANNEL_4  4
 #define PARAM_LOCK_CHANNEL_5  5
 
+// channels for parameters set with Func + knob, after the 6 knob channels
+#ifdef ENABLE_WAVETABLE_MORPH
+#define PARAM_LOCK_CHANNEL_MORPH  6
+#define MAX_PARAMETER_LOCKS 7
+#else
+#define MAX_PARAMETER_LOCKS 6
+#endif
+
 
 //#define SEQUENCER_TESTMODE
 
@@ -152,6 +160,7 @@ class MutatingSequencer
 
     uint8_t currentScaleMode;
     byte tonicNote;     
+    byte tonicStep;             // tonicNote in notes of the tuning
     byte octave;               
 
     byte bpm;
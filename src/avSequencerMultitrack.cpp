@@ -11,6 +11,7 @@
 #include <MozziGuts.h>
 
 #include "Arduino.h"
+#include "tuning.h"
 #include "avSequencerMultiTrack.h"
 
 
@@ -28,7 +29,7 @@ MutatingSequencerMultiTrack::MutatingSequencerMultiTrack()
   {
     currentTrackStep[i]    = 0;
     trackSequenceLength[i] = 16;
-    currentTrackNote[i]    = tonicNote;
+    currentTrackNote[i]    = tonicStep;
   }
 
   // setup different defaults for this synth due to the "busy" nature of having 2 tracks 
@@ -123,7 +124,7 @@ byte MutatingSequencerMultiTrack::getCurrentNote(byte track)
   }
   else
   {
-    return theNote + (12*octaveOffsetTrack1);
+    return theNote + (TUNING_NOTES_PER_OCTAVE*octaveOffsetTrack1);
   }
 }
 
@@ -301,12 +302,12 @@ void MutatingSequencerMultiTrack::mutateSequenceDefault()
       {
         if (rand(100) < tonicProbability) 
         {
-          notes[seqStep] = tonicNote + (12*octave) + (12*rand(octaveSpread));
+          notes[seqStep] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + (TUNING_NOTES_PER_OCTAVE*rand(octaveSpread));
         }
         else
         {
                         //root        //octave        //scale note                        //octave
-          notes[seqStep] = tonicNote + (12*octave) + scaleNotes[rand(scaleNoteCount)] + (12*rand(octaveSpread));
+          notes[seqStep] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + scaleNotes[rand(scaleNoteCount)] + (TUNING_NOTES_PER_OCTAVE*rand(octaveSpread));
         }
 
         // randomise the deviation
@@ -377,7 +378,7 @@ void MutatingSequencerMultiTrack::mutateSequenceArp()
       {
         seqStep = (startStep + i) % MAX_SEQUENCE_LENGTH;
         seqNote = scaleNotes[(startNote + (i*stepSize*runDirection) ) % scaleNoteCount];
-        notes[seqStep] = tonicNote + seqNote + (12*(startOctave + (startNote + i < scaleNoteCount ? 0 : 1)));
+        notes[seqStep] = tonicStep + seqNote + (TUNING_NOTES_PER_OCTAVE*(startOctave + (startNote + i < scaleNoteCount ? 0 : 1)));
         #ifndef ENABLE_MIDI_OUTPUT
         Serial.print(notes[seqStep]);
         Serial.print(F(","));
@@ -400,7 +401,7 @@ void MutatingSequencerMultiTrack::mutateSequenceArp2()
 {
   for (uint8_t i = 0; i < trackSequenceLength[0]; i++)
   {
-    notes[i] = tonicNote + (12*octave) + scaleNotes[i % (min(trackSequenceLength[0],scaleNoteCount))];
+    notes[i] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave) + scaleNotes[i % (min(trackSequenceLength[0],scaleNoteCount))];
   }
 }
 
@@ -413,7 +414,7 @@ void MutatingSequencerMultiTrack::mutateSequenceArp2()
 void MutatingSequencerMultiTrack::mutateSequenceDrone()
 {
 
-  notes[0] = tonicNote + (12*octave);
+  notes[0] = tonicStep + (TUNING_NOTES_PER_OCTAVE*octave);
 
   for (int i=1; i < MAX_SEQUENCE_LENGTH; i++)
   {
@@ -2,6 +2,9 @@
   avSource.h - defines a sound source using a virtual base class and a derived class which implements the particular sound source
    
   in this case, a 2-operator FM voice with envelope & lfo modulation control
+
+  the control-rate interface is virtual.  updateAudio() is not - it is called 16384 times a second so it is
+  dispatched at compile time on the concrete voice type and defined inline at the bottom of this file
 */
 
 #ifndef avSource_h
@@ -15,16 +18,92 @@
 #include <EventDelay.h>
 #include <Oscil.h>
 #include <tables/sin2048_int8.h> // sine table for oscillators & LFO
-#include <tables/saw2048_int8.h> // saw table for LFO
-#include "revsaw2048_int8.h" // reverse saw table for LFO
-#include "square2048_int8.h" // square table for LFO
-
-/** @brief if COMPILE_SMALLER_BINARY flag is defined, omit the pseudorandom waveform */
-#ifndef COMPILE_SMALLER_BINARY
-#include "pseudorandom2048_int8.h" // noise table for LFO
+#include <tables/saw2048_int8.h> // saw table for oscillators & LFO - also read as reverse saw & square
+
+/** @brief INTERPOLATED_WAVETABLE_CELLS swaps the 2048-cell tables for smaller ones read with interpolation */
+#ifdef INTERPOLATED_WAVETABLE_CELLS
+  #include "avInterpolatingOscil.h"
+
+  #if INTERPOLATED_WAVETABLE_CELLS == 256
+    #include <tables/sin256_int8.h>
+    #include <tables/saw256_int8.h>
+    #include "nullwaveform256_int8.h"
+    #define WAVETABLE_SIN_DATA  SIN256_DATA
+    #define WAVETABLE_SAW_DATA  SAW256_DATA
+    #define WAVETABLE_NULL_DATA NULLWAVEFORM256_DATA
+
+    // the extra waveforms in the bank, eg WAVETABLE_DATA(TRIANGLE) is TRIANGLE256_DATA
+    #include "triangle256_int8.h"
+    #include "pulsequarter256_int8.h"
+    #include "pulseeighth256_int8.h"
+    #include "sineoctave256_int8.h"
+    #include "sinetwelfth256_int8.h"
+    #include "organ256_int8.h"
+    #include "hollow256_int8.h"
+    #include "formant256_int8.h"
+    #include "metallic256_int8.h"
+    #include "softsaw256_int8.h"
+    #define WAVETABLE_DATA(NAME) NAME##256_DATA
+
+    #ifdef ENABLE_BANDLIMITED_WAVETABLES
+      #include "sawbandlimited256_int8.h"
+      #include "squarebandlimited256_int8.h"
+      #define WAVETABLE_SAW_BANDLIMITED_DATA    SAWBANDLIMITED256_DATA
+      #define WAVETABLE_SQUARE_BANDLIMITED_DATA SQUAREBANDLIMITED256_DATA
+      #define WAVETABLE_BANDLIMITED_LEVELS      SAWBANDLIMITED256_LEVELS
+    #endif
+  #elif INTERPOLATED_WAVETABLE_CELLS == 512
+    #include <tables/sin512_int8.h>
+    #include <tables/saw512_int8.h>
+    #include "nullwaveform512_int8.h"
+    #define WAVETABLE_SIN_DATA  SIN512_DATA
+    #define WAVETABLE_SAW_DATA  SAW512_DATA
+    #define WAVETABLE_NULL_DATA NULLWAVEFORM512_DATA
+
+    // the extra waveforms in the bank, eg WAVETABLE_DATA(TRIANGLE) is TRIANGLE512_DATA
+    #include "triangle512_int8.h"
+    #include "pulsequarter512_int8.h"
+    #include "pulseeighth512_int8.h"
+    #include "sineoctave512_int8.h"
+    #include "sinetwelfth512_int8.h"
+    #include "organ512_int8.h"
+    #include "hollow512_int8.h"
+    #include "formant512_int8.h"
+    #include "metallic512_int8.h"
+    #include "softsaw512_int8.h"
+    #define WAVETABLE_DATA(NAME) NAME##512_DATA
+
+    #ifdef ENABLE_BANDLIMITED_WAVETABLES
+      #include "sawbandlimited512_int8.h"
+      #include "squarebandlimited512_int8.h"
+      #define WAVETABLE_SAW_BANDLIMITED_DATA    SAWBANDLIMITED512_DATA
+      #define WAVETABLE_SQUARE_BANDLIMITED_DATA SQUAREBANDLIMITED512_DATA
+      #define WAVETABLE_BANDLIMITED_LEVELS      SAWBANDLIMITED512_LEVELS
+    #endif
+  #else
+    #error INTERPOLATED_WAVETABLE_CELLS must be 256 or 512
+  #endif
+
+  #define WAVETABLE_NUM_CELLS INTERPOLATED_WAVETABLE_CELLS
+#else
+  #include "nullwaveform2048_int8.h" // zero table for LFO - used to turn carrier off
+  #define WAVETABLE_SIN_DATA  SIN2048_DATA
+  #define WAVETABLE_SAW_DATA  SAW2048_DATA
+  #define WAVETABLE_NULL_DATA NULLWAVEFORM2048_DATA
+  #define WAVETABLE_NUM_CELLS SIN2048_NUM_CELLS
+
+  #ifdef ENABLE_BANDLIMITED_WAVETABLES
+    #error ENABLE_BANDLIMITED_WAVETABLES needs INTERPOLATED_WAVETABLE_CELLS - a set of 2048-cell tables would fill the flash
+  #endif
+
+  #ifdef ENABLE_WAVETABLE_MORPH
+    #error ENABLE_WAVETABLE_MORPH needs INTERPOLATED_WAVETABLE_CELLS - the morph table is in RAM, too small for 2048 cells
+  #endif
+#endif
+#include "gaincurve256_uint8.h" // volume curve for setGain()
+#ifdef ENABLE_SOFT_CLIP_MIXER
+#include "softclip512_int8.h" // saturation curve for softClipVoiceMix()
 #endif
-
-#include "nullwaveform2048_int8.h" // zero table for LFO - used to turn carrier off
 #include <mozzi_fixmath.h>
 #include <ADSR.h>
 
@@ -32,12 +111,26 @@
 
 //#define DEBUG_MODE_VERBOSE
 
+// FM_OPERATORS (MutantFMSynthOptions.h) is 2 when it isn't set:  just the carrier & modulator
+#ifndef FM_OPERATORS
+#define FM_OPERATORS 2
+#endif
+
+#if FM_OPERATORS < 2 || FM_OPERATORS > 4
+#error FM_OPERATORS must be 3 or 4
+#endif
+
+// ways to mix the two voices with ENABLE_VOICE_MIX_MODES, see the mix kernels in MutantFMSynth.ino
+#define VOICE_MIX_SUM       0
+#define VOICE_MIX_RING      1
+#define VOICE_MIX_AM        2
+#define MAX_VOICE_MIX_MODES 3
+
 // define this here to avoid clipping the filter function
 #define MAX_FILTER_RESONANCE  100
 #define MAX_FILTER_CUTOFF     240
 #define MAX_FILTER_SHAPE      1023
 #define MAX_FILTER_ENV_ATTACK 4096
-#define MAX_SOURCE_PARAMS     9
 
 #define SYNTH_PARAMETER_MOD_AMOUNT            1
 #define SYNTH_PARAMETER_MOD_RATIO             2
@@ -47,6 +140,29 @@
 #define SYNTH_PARAMETER_ENVELOPE_SHAPE        5
 #define SYNTH_PARAMETER_ENVELOPE_ATTACK     7
 #define SYNTH_PARAMETER_ENVELOPE_DECAY      8
+
+// the options' parameters are only numbered when the option is on, in the slots after the ones above, so param[] 
+// has no unused slots.  modulator feedback & the extra operators can't be combined, so they share the slots 
+// after the morph's
+#ifdef ENABLE_WAVETABLE_MORPH
+#define SYNTH_PARAMETER_CARRIER_MORPH         9
+#define SYNTH_PARAMETER_CARRIER_MORPH_LFODEPTH 10
+#define SYNTH_PARAMETER_OPTION_SLOT           11
+#else
+#define SYNTH_PARAMETER_OPTION_SLOT           9
+#endif
+
+#if FM_OPERATORS > 2
+#define SYNTH_PARAMETER_OPERATOR_RATIO        (SYNTH_PARAMETER_OPTION_SLOT)
+#define SYNTH_PARAMETER_OPERATOR_AMOUNT       (SYNTH_PARAMETER_OPTION_SLOT + 1)
+#define MAX_SOURCE_PARAMS                     (SYNTH_PARAMETER_OPTION_SLOT + 2)
+#elif defined(ENABLE_MODULATOR_FEEDBACK)
+#define SYNTH_PARAMETER_MODULATOR_FEEDBACK    (SYNTH_PARAMETER_OPTION_SLOT)
+#define MAX_SOURCE_PARAMS                     (SYNTH_PARAMETER_OPTION_SLOT + 1)
+#else
+#define MAX_SOURCE_PARAMS                     (SYNTH_PARAMETER_OPTION_SLOT)
+#endif
+
 #define SYNTH_PARAMETER_NOTE_DECAY          -2  // this isn't implemented in the synth voice - it's in the sequencer, probably should be though
 #define SYNTH_PARAMETER_UNKNOWN             -1
 
@@ -60,32 +176,36 @@
 #define FM_MODE_FREE        3
 #define MAX_FM_MODES        4
 
-/** @brief if COMPILE_SMALLER_BINARY flag is defined, omit the pseudorandom waveform */
-#ifdef COMPILE_SMALLER_BINARY
-
-  #define MAX_LFO_WAVEFORMS       5
-  #define MAX_CARRIER_WAVEFORMS   5
-  #define MAX_MODULATOR_WAVEFORMS 5
-
-  #define WAVEFORM_SIN          0
-  #define WAVEFORM_SAW          1
-  #define WAVEFORM_REVSAW       2
-  #define WAVEFORM_SQUARE       3
-  #define WAVEFORM_NULL         4
-
+// indexes into the waveform bank (waveformBank in avSourceFM.cpp), in the order the toggles step through them
+#define WAVEFORM_SIN          0
+#define WAVEFORM_SAW          1
+#define WAVEFORM_REVSAW       2
+#define WAVEFORM_SQUARE       3
+
+// small interpolated tables leave room in flash for more waveforms
+#ifdef INTERPOLATED_WAVETABLE_CELLS
+#define WAVEFORM_TRIANGLE     4
+#define WAVEFORM_PULSEQUARTER 5
+#define WAVEFORM_PULSEEIGHTH  6
+#define WAVEFORM_SINEOCTAVE   7
+#define WAVEFORM_SINETWELFTH  8
+#define WAVEFORM_ORGAN        9
+#define WAVEFORM_HOLLOW       10
+#define WAVEFORM_FORMANT      11
+#define WAVEFORM_METALLIC     12
+#define WAVEFORM_SOFTSAW      13
+#define WAVEFORM_NOISE        14
+#define WAVEFORM_NULL         15
 #else
-  #define MAX_LFO_WAVEFORMS       6
-  #define MAX_CARRIER_WAVEFORMS   6
-  #define MAX_MODULATOR_WAVEFORMS 6
-
-  #define WAVEFORM_SIN          0
-  #define WAVEFORM_SAW          1
-  #define WAVEFORM_REVSAW       2
-  #define WAVEFORM_SQUARE       3
-  #define WAVEFORM_PSEUDORANDOM 4
-  #define WAVEFORM_NULL         5
+#define WAVEFORM_NOISE        4
+#define WAVEFORM_NULL         5
 #endif
 
+#define MAX_WAVEFORMS           (WAVEFORM_NULL + 1)
+#define MAX_LFO_WAVEFORMS       MAX_WAVEFORMS
+#define MAX_CARRIER_WAVEFORMS   MAX_WAVEFORMS
+#define MAX_MODULATOR_WAVEFORMS MAX_WAVEFORMS
+
 
 // increase for wider LFO depth range
 // LFO depth will be multiplied by 2^n using a bitshift
@@ -97,24 +217,181 @@
 // 0 value should be optimised out by the compiler
 #define MOD_DEPTH_MULTIPLIER_ENV 0
 
+// the noise waveform changes to a new random value this often:  every 2^n of the oscillator's phase
+// a cycle is SIN2048_NUM_CELLS << 16 = 2^27, so 22 gives 32 values per cycle and the noise follows the pitch
+#define NOISE_SEGMENT_SHIFT 22
+
+// ENABLE_BANDLIMITED_WAVETABLES picks table n for carrier phase increments under 2^(n + 19).  table n has 128 >> n 
+// harmonics, and the highest reaches Nyquist (an increment of 2^26, half a cycle per sample) at 2^(n + 19)
+#define BANDLIMITED_LEVEL_SHIFT 19
+
+//making LFO update rate lower than control rate to save processing.  places upper limit on LFO frequency
+#define LFO_OSCILLATOR_UPDATE_RATE 64
+
+// number of audio samples per control tick as a power of 2 = AUDIO_RATE / CONTROL_RATE in MutantFMSynth.ino
+// ENABLE_AUDIO_RATE_RAMPS spreads each control-rate change of gain & modulation over this many samples
+#define AUDIO_RAMP_SHIFT 7
+
+// operator routings for FM_OPERATORS 3 or 4, see FMAlgorithm
+#define FM_ALGORITHM_STACK    0
+#define FM_ALGORITHM_PARALLEL 1
+#define FM_ALGORITHM_2PLUS2   2
+
+#ifndef FM_ALGORITHM
+#define FM_ALGORITHM FM_ALGORITHM_STACK
+#endif
+
+#if FM_ALGORITHM == FM_ALGORITHM_2PLUS2 && FM_OPERATORS != 4
+#error FM_ALGORITHM_2PLUS2 needs FM_OPERATORS 4
+#endif
+
+#if FM_OPERATORS > 2 && defined(ENABLE_MODULATOR_FEEDBACK)
+#error the extra operators & modulator feedback are both set with Func + ratio - turn off FM_OPERATORS or ENABLE_MODULATOR_FEEDBACK
+#endif
+
+#if defined(ENABLE_SOFT_CLIP_MIXER) && defined(ENABLE_FUSED_VOICE_KERNEL)
+#error the soft clip sums the voices before its curve, so the fused kernel can not be used with it - turn off ENABLE_SOFT_CLIP_MIXER or ENABLE_FUSED_VOICE_KERNEL
+#endif
+
+// the voices that play the extra operators - only the first on an ATmega328P, where two overrun the audio budget
+#ifndef FM_OPERATOR_VOICES
+  #ifdef __AVR_ATmega328P__
+    #define FM_OPERATOR_VOICES 1
+  #else
+    #define FM_OPERATOR_VOICES 2
+  #endif
+#endif
+
+// operators played by voice0 & voice1 in MutantFMSynth.ino
+#define FM_OPERATORS_VOICE0 FM_OPERATORS
+#if FM_OPERATOR_VOICES > 1
+#define FM_OPERATORS_VOICE1 FM_OPERATORS
+#else
+#define FM_OPERATORS_VOICE1 2
+#endif
+
+// oscillators for the carrier & modulator, and the LFO
+#ifdef INTERPOLATED_WAVETABLE_CELLS
+typedef InterpolatingOscil <WAVETABLE_NUM_CELLS, AUDIO_RATE> OperatorOscil;
+typedef InterpolatingOscil <WAVETABLE_NUM_CELLS, LFO_OSCILLATOR_UPDATE_RATE> LFOOscil;
+#else
+typedef Oscil <SIN2048_NUM_CELLS, AUDIO_RATE> OperatorOscil;
+typedef Oscil <SIN2048_NUM_CELLS, LFO_OSCILLATOR_UPDATE_RATE> LFOOscil;
+#endif
+
+// with ENABLE_WAVETABLE_MORPH the carrier reads a table in RAM that holds the morph between its waveform & the
+// next, rebuilt by updateControl() when the morph moves to another of its 16 steps.  256 cells whatever the
+// wavetable size, so the two voices' tables take 512 bytes of the Nano's 2KB
+#ifdef ENABLE_WAVETABLE_MORPH
+#define CARRIER_MORPH_TABLE_CELLS 256
+#define CARRIER_MORPH_STEP_SHIFT  4
+typedef InterpolatingOscil <CARRIER_MORPH_TABLE_CELLS, AUDIO_RATE, true> CarrierOscil;
+#else
+typedef OperatorOscil CarrierOscil;
+#endif
+
 // this is the shortest decay time that can be audible with the mod envelope with the given CONTROL_RATE
 #define MIN_MODULATION_ENV_TIME 30
 
 //#define SYNTH_MODULATION_UPDATE_DIVIDER 2
 
+/*----------------------------------------------------------------------------------------------------------
+ * WaveformVariant
+ * how an oscillator's samples are changed after the table read, so reverse saw & square are read from the 
+ * saw table instead of needing 2KB tables of their own.  see applyWaveformVariant()
+ *
+ *    squareMask  0xFF replaces each sample with its sign:  0 or -1
+ *    invertMask  XORed with the result:  0xFF gives ~sample = -1 - sample, 0x80 moves 0/-1 to -128/127
+ *----------------------------------------------------------------------------------------------------------
+ */
+struct WaveformVariant
+{
+  uint8_t squareMask;
+  uint8_t invertMask;
+};
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * WaveformBankEntry
+ * one waveform in the bank:  the table its oscillator reads and the variant applied to the samples
+ * the bank is in PROGMEM, indexed by WAVEFORM_*, so adding a waveform is adding an entry
+ *----------------------------------------------------------------------------------------------------------
+ */
+struct WaveformBankEntry
+{
+  const int8_t*   table;
+  WaveformVariant variant;
+};
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * applyWaveformVariant()
+ * returns the sample with the variant applied - no branches, so every waveform costs the same
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int8_t applyWaveformVariant(int8_t sample, WaveformVariant variant)
+{
+  int8_t sign = sample >> 7;
+  return sample ^ ((sample ^ sign) & variant.squareMask) ^ variant.invertMask;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * NoiseSource
+ * state for the noise waveform - a 16 bit xorshift sampled & held each time the oscillator's phase moves on 
+ * by 2^NOISE_SEGMENT_SHIFT.  see nextNoise()
+ *----------------------------------------------------------------------------------------------------------
+ */
+struct NoiseSource
+{
+  uint16_t  state;      // never 0
+  uint8_t   segment;    // phase >> NOISE_SEGMENT_SHIFT when the value last changed
+  int8_t    value;
+};
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * nextNoise()
+ * returns the noise sample for an oscillator at the given phase.  xorshift (7,9,8) has a period of 65535 
+ * values, over 2000 cycles of the oscillator, so unlike a table the noise doesn't repeat every cycle
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int8_t nextNoise(NoiseSource& noise, uint32_t phase)
+{
+  uint8_t segment = phase >> NOISE_SEGMENT_SHIFT;
+
+  if (segment != noise.segment)
+  {
+    noise.segment  = segment;
+    noise.state   ^= noise.state << 7;
+    noise.state   ^= noise.state >> 9;
+    noise.state   ^= noise.state << 8;
+    noise.value    = noise.state >> 8;
+  }
+  return noise.value;
+}
+
+
+
+template <uint8_t ALGORITHM, uint8_t OPERATORS>
+struct FMAlgorithm;
+
 class MutatingSource
 {
   public:
     MutatingSource();
 
-    virtual int noteOn(byte pitch, byte velocity, unsigned int length);
-    virtual int noteOff();
-    virtual inline int updateAudio();
-    virtual inline void updateControl();
-    virtual int mutate();
-    virtual void setGain(byte gain);
-    virtual void setParam(uint8_t paramIndex, uint16_t newValue);
-    virtual uint16_t getParam(byte paramIndex);
+    virtual int noteOn(uint8_t pitch, uint8_t velocity, uint16_t length) = 0;
+    virtual int noteOff() = 0;
+    virtual void updateControl() = 0;
+    virtual int mutate() = 0;
+    virtual void setGain(byte gain) = 0;
+    virtual void setParam(uint8_t paramIndex, uint16_t newValue) = 0;
+    virtual uint16_t getParam(byte paramIndex) = 0;
     
     
   protected:
@@ -125,14 +402,20 @@ class MutatingSource
     
 };
 
-class MutatingFM : public MutatingSource
+// final so calls through a MutatingFM pointer or reference don't go through the vtable
+class MutatingFM final : public MutatingSource
 {
   public:
-    MutatingFM();
+    MutatingFM(uint8_t operatorCount = FM_OPERATORS_VOICE0);
 
     int noteOn(uint8_t pitch, uint8_t velocity, uint16_t length);  
     int noteOff();
-    int updateAudio();
+    template <uint8_t OPERATORS = FM_OPERATORS_VOICE0> 
+    inline int updateAudio();
+    template <uint8_t OPERATORS = FM_OPERATORS_VOICE0> 
+    inline int16_t nextSample();
+    template <uint8_t OPERATORS_A = FM_OPERATORS_VOICE0, uint8_t OPERATORS_B = FM_OPERATORS_VOICE1> 
+    static inline int updateAudioPair(MutatingFM& voiceA, MutatingFM& voiceB);
     void updateControl();
     int mutate();
     void setParam(uint8_t paramIndex, uint16_t newValue);
@@ -140,7 +423,6 @@ class MutatingFM : public MutatingSource
     
     void setGain(uint8_t gain);
 
-    void setOscillator(uint8_t oscIndex);
     uint8_t getLFOValue();
     void  setLFOFrequency(float freq);
     void setModulationShape(uint16_t newValue);
@@ -157,29 +439,104 @@ class MutatingFM : public MutatingSource
     void toggleModulatorWaveform();
     uint8_t getModulatorWaveform();
 
+    static uint32_t getModulatorPhaseIncrement(uint32_t carrierPhaseIncrement, uint8_t fmMode, uint16_t modRatio);
+
   protected:
+    template <uint8_t ALGORITHM, uint8_t OPERATORS> 
+    friend struct FMAlgorithm;
     
     // for FM oscillator
     void setFreqs(uint8_t midiNote);
-
-    Q16n16 carrierFrequency;
-    Q16n16 modulationFrequency;
+    void setCarrierTable();
+    #ifdef ENABLE_WAVETABLE_MORPH
+    void fillCarrierMorphTable();
+    #endif
+    const int8_t* getCarrierWaveformTable(uint8_t waveform, WaveformVariant& variant);
+    const int8_t* getWaveformTable(uint8_t waveform);
+    WaveformVariant getWaveformVariant(uint8_t waveform);
+
+    // operator outputs for the next audio sample
+    inline int8_t  nextModulatorSample(Q15n16 phaseModulation = 0);
+    inline int8_t  nextCarrierSample(Q15n16 phaseModulation);
+
+    // gain & modulation amount for the next audio sample
+    inline uint8_t nextGain();
+    inline Q16n16  nextModulatorAmount();
+    inline Q15n16  nextPhaseModulation(int8_t modulatorSample);
+    inline Q15n16  nextOperatorModulation(int16_t operatorSample);
+
+    #if FM_OPERATORS > 2
+    inline bool playsOperators();
+    #endif
+
+
+    uint32_t carrierPhaseIncrement;
+    uint32_t modulatorPhaseIncrement;
     Q16n16 modulatorAmount;
 
+    #ifdef ENABLE_16BIT_MODULATION_INDEX
+    // modulatorAmount pre-scaled to 16 bits by updateControl() for the audio path.  max 2038
+    int16_t modulationIndex;
+    #endif
+
     uint8_t  currentGain;
     uint8_t  masterGain;
-    uint8_t masterGainBitShift;
+    uint8_t  masterGainLevel;
+
+    #ifdef ENABLE_AUDIO_RATE_RAMPS
+    // audio-rate ramps from the previous control tick's gain & modulation amount to the current ones
+    // gainRamp is 8.8 fixed point
+    uint16_t gainRamp;
+    int16_t  gainRampStep;
+    Q16n16   modulatorAmountRamp;
+    int32_t  modulatorAmountRampStep;
+    #endif
+
     uint8_t lastLFOValue;
     uint8_t fmMode;
     uint8_t lfoWaveform;
     uint8_t carrierWaveform;
     uint8_t modulatorWaveform;
-
-    Oscil<SIN2048_NUM_CELLS, AUDIO_RATE>* carrier;
-    Oscil<SIN2048_NUM_CELLS, AUDIO_RATE>* modulator;
-    ADSR <CONTROL_RATE, CONTROL_RATE>* envelopeAmp;
-    ADSR <CONTROL_RATE, CONTROL_RATE>* envelopeMod;
-    Oscil <SIN2048_NUM_CELLS, CONTROL_RATE>* lfo;
+    WaveformVariant lfoVariant;
+    WaveformVariant carrierVariant;
+    WaveformVariant modulatorVariant;
+    #ifdef ENABLE_WAVETABLE_MORPH
+    // how far the carrier is crossfaded towards the next waveform, 0-255 in 16 steps.  set by updateControl()
+    uint8_t carrierMorph;
+    #endif
+    #ifdef ENABLE_MODULATOR_FEEDBACK
+    // feedback amount 0-255, set by updateControl(), and the modulator's last two outputs
+    uint8_t modulatorFeedback;
+    int8_t  modulatorFeedbackSample;
+    int8_t  lastModulatorSample;
+    #endif
+    NoiseSource lfoNoise;
+    NoiseSource carrierNoise;
+    NoiseSource modulatorNoise;
+
+    // owned by the voice so the audio path reads them at a fixed offset rather than through a pointer
+    CarrierOscil  carrier;
+    OperatorOscil modulator;
+    #ifdef ENABLE_WAVETABLE_MORPH
+    // the carrier's waveform crossfaded towards the next by carrierMorph, with both variants applied
+    int8_t        carrierMorphTable[CARRIER_MORPH_TABLE_CELLS];
+    #endif
+    #if FM_OPERATORS > 2
+    // the 3rd & 4th operators, always sine, and their modulation index set by updateControl().  max 1018 - times 
+    // a sample it's a Q15n16 phase offset of up to 2 cycles
+    #if FM_OPERATOR_VOICES > 1
+    OperatorOscil operators[FM_OPERATORS - 2];
+    uint16_t      operatorAmount;
+    #else
+    // only one voice plays them, so there's one set, owned by the voice constructed with FM_OPERATORS operators
+    static OperatorOscil operators[FM_OPERATORS - 2];
+    static uint16_t      operatorAmount;
+    bool                 ownsOperators;
+    #endif
+    #endif
+    ADSR <CONTROL_RATE, CONTROL_RATE> envelopeAmp;
+    ADSR <CONTROL_RATE, CONTROL_RATE> envelopeMod;
+    LFOOscil lfo;
 
   private:
     uint8_t lastMidiNote;
@@ -189,4 +546,328 @@ class MutatingFM : public MutatingSource
 
 };
 
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextModulatorSample()
+ * steps the modulator and returns its output
+ * phaseModulation comes from the operators above it in the FM_OPERATORS stack algorithms, otherwise it's 0
+ * with ENABLE_MODULATOR_FEEDBACK the phase is offset by the average of the last two outputs times 
+ * modulatorFeedback, as a Q15n16 fraction of a cycle - up to +/- half a cycle, where a sine is already noise.  
+ * averaging stops it flipping between two values when the feedback is high, as on a DX7
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int8_t MutatingFM::nextModulatorSample(Q15n16 phaseModulation)
+{
+  #ifdef ENABLE_MODULATOR_FEEDBACK
+  // int8 * uint8 fits in 16 bits, so this is an 8x8 multiply
+  phaseModulation += (int16_t)(modulatorFeedbackSample * modulatorFeedback);
+  #endif
+
+  #if defined(ENABLE_MODULATOR_FEEDBACK) || FM_OPERATORS > 2
+  int8_t sample = applyWaveformVariant(modulator.phMod(phaseModulation), modulatorVariant);
+  #else
+  // nothing offsets the modulator's phase
+  (void)phaseModulation;
+  int8_t sample = applyWaveformVariant(modulator.next(), modulatorVariant);
+  #endif
+
+  if (modulatorWaveform == WAVEFORM_NOISE)
+  {
+    sample = nextNoise(modulatorNoise, modulator.getPhaseFractional());
+  }
+
+  #ifdef ENABLE_MODULATOR_FEEDBACK
+  modulatorFeedbackSample = ((int16_t)lastModulatorSample + sample) >> 1;
+  lastModulatorSample     = sample;
+  #endif
+  return sample;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextCarrierSample()
+ * steps the carrier and returns its output at the phase offset by the modulator
+ * with ENABLE_WAVETABLE_MORPH the carrier reads carrierMorphTable, which is already crossfaded towards the next 
+ * waveform, so the morph costs nothing here.  noise & off have no table, so morphing towards them fades the 
+ * carrier out
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int8_t MutatingFM::nextCarrierSample(Q15n16 phaseModulation)
+{
+  #ifdef ENABLE_WAVETABLE_MORPH
+  int8_t sample = carrier.phMod(phaseModulation);
+  #else
+  int8_t sample = applyWaveformVariant(carrier.phMod(phaseModulation), carrierVariant);
+  #endif
+
+  if (carrierWaveform == WAVEFORM_NOISE)
+  {
+    // noise follows the modulated phase, as phMod() reads the table
+    int8_t noise = nextNoise(carrierNoise, carrier.getPhaseFractional() + (uint32_t)phaseModulation * SIN2048_NUM_CELLS);
+
+    #ifdef ENABLE_WAVETABLE_MORPH
+    // the table only holds the next waveform's share of the morph, so the noise makes up the rest
+    sample += ((int16_t)noise * (256 - carrierMorph)) >> 8;
+    #else
+    sample = noise;
+    #endif
+  }
+  return sample;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextGain()
+ * returns the amplitude for the next audio sample
+ * either the value set by the last updateControl(), or with ENABLE_AUDIO_RATE_RAMPS the next step of 
+ * a linear ramp that reaches it on the last sample before the next updateControl()
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline uint8_t MutatingFM::nextGain()
+{
+  #ifdef ENABLE_AUDIO_RATE_RAMPS
+  gainRamp += gainRampStep;
+  return gainRamp >> 8;
+  #else
+  return currentGain;
+  #endif
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextModulatorAmount()
+ * returns the modulation amount for the next audio sample, ramped the same way as nextGain()
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline Q16n16 MutatingFM::nextModulatorAmount()
+{
+  #ifdef ENABLE_AUDIO_RATE_RAMPS
+  modulatorAmountRamp += modulatorAmountRampStep;
+  return modulatorAmountRamp;
+  #else
+  return modulatorAmount;
+  #endif
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextPhaseModulation()
+ * returns the carrier phase offset for the next audio sample as a Q15n16 fraction of a cycle
+ * normally a 32x8 multiply of the modulation amount.  with ENABLE_16BIT_MODULATION_INDEX it's a 16x8 multiply
+ * of the amount pre-scaled by updateControl(), which rounds off the bottom 8 bits - see host/modIndexError.cpp
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline Q15n16 MutatingFM::nextPhaseModulation(int8_t modulatorSample)
+{
+  #if defined(ENABLE_16BIT_MODULATION_INDEX) && defined(ENABLE_AUDIO_RATE_RAMPS)
+  // the ramp runs at full precision, only its top 16 bits are used
+  return (int32_t)(int16_t)(nextModulatorAmount() >> 8) * modulatorSample;
+  #elif defined(ENABLE_16BIT_MODULATION_INDEX)
+  return (int32_t)modulationIndex * modulatorSample;
+  #else
+  return nextModulatorAmount() * modulatorSample >> 8;
+  #endif
+}
+
+
+
+#if FM_OPERATORS > 2
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::playsOperators()
+ * true if the voice sets up & updates the 3rd & 4th operators - every voice, unless FM_OPERATOR_VOICES is 1
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline bool MutatingFM::playsOperators()
+{
+  #if FM_OPERATOR_VOICES > 1
+  return true;
+  #else
+  return ownsOperators;
+  #endif
+}
+#endif
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextOperatorModulation()
+ * returns the phase offset from the 3rd & 4th operators, or the sum of both, as a Q15n16 fraction of a cycle
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline Q15n16 MutatingFM::nextOperatorModulation(int16_t operatorSample)
+{
+  #if FM_OPERATORS > 2
+  return (int32_t)operatorAmount * operatorSample;
+  #else
+  (void)operatorSample;
+  return 0;
+  #endif
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * FMAlgorithm
+ * the routing of a voice's operators for each FM_ALGORITHM & operator count.  each is a specialization, so the
+ * routing is fixed at compile time and the audio path has no branches.  next() steps every operator and returns 
+ * the voice's sample before the gain
+ *
+ * with 2 operators every algorithm is the modulator into the carrier
+ *----------------------------------------------------------------------------------------------------------
+ */
+template <uint8_t ALGORITHM>
+struct FMAlgorithm <ALGORITHM, 2>
+{
+  static inline int8_t next(MutatingFM& voice)
+  {
+    int8_t modulatorSample = voice.nextModulatorSample();
+    return voice.nextCarrierSample(voice.nextPhaseModulation(modulatorSample));
+  }
+};
+
+#if FM_OPERATORS > 2
+// 3 -> modulator -> carrier
+template <>
+struct FMAlgorithm <FM_ALGORITHM_STACK, 3>
+{
+  static inline int8_t next(MutatingFM& voice)
+  {
+    int8_t operator3Sample = voice.operators[0].next();
+    int8_t modulatorSample = voice.nextModulatorSample(voice.nextOperatorModulation(operator3Sample));
+    return voice.nextCarrierSample(voice.nextPhaseModulation(modulatorSample));
+  }
+};
+
+// 4 -> 3 -> modulator -> carrier
+template <>
+struct FMAlgorithm <FM_ALGORITHM_STACK, 4>
+{
+  static inline int8_t next(MutatingFM& voice)
+  {
+    int8_t operator4Sample = voice.operators[1].next();
+    int8_t operator3Sample = voice.operators[0].phMod(voice.nextOperatorModulation(operator4Sample));
+    int8_t modulatorSample = voice.nextModulatorSample(voice.nextOperatorModulation(operator3Sample));
+    return voice.nextCarrierSample(voice.nextPhaseModulation(modulatorSample));
+  }
+};
+
+// modulator + 3 -> carrier
+template <>
+struct FMAlgorithm <FM_ALGORITHM_PARALLEL, 3>
+{
+  static inline int8_t next(MutatingFM& voice)
+  {
+    int8_t operator3Sample = voice.operators[0].next();
+    int8_t modulatorSample = voice.nextModulatorSample();
+    return voice.nextCarrierSample(voice.nextPhaseModulation(modulatorSample) + voice.nextOperatorModulation(operator3Sample));
+  }
+};
+
+// modulator + 3 + 4 -> carrier.  3 & 4 share an amount, so they're summed before one multiply
+template <>
+struct FMAlgorithm <FM_ALGORITHM_PARALLEL, 4>
+{
+  static inline int8_t next(MutatingFM& voice)
+  {
+    int16_t operatorSum     = (int16_t)voice.operators[0].next() + voice.operators[1].next();
+    int8_t  modulatorSample = voice.nextModulatorSample();
+    return voice.nextCarrierSample(voice.nextPhaseModulation(modulatorSample) + voice.nextOperatorModulation(operatorSum));
+  }
+};
+
+// (modulator -> carrier) + (4 -> 3), averaged so it stays in 8 bits - 6dB quieter than the other algorithms
+template <>
+struct FMAlgorithm <FM_ALGORITHM_2PLUS2, 4>
+{
+  static inline int8_t next(MutatingFM& voice)
+  {
+    int8_t operator4Sample = voice.operators[1].next();
+    int8_t operator3Sample = voice.operators[0].phMod(voice.nextOperatorModulation(operator4Sample));
+    int8_t modulatorSample = voice.nextModulatorSample();
+    int8_t carrierSample   = voice.nextCarrierSample(voice.nextPhaseModulation(modulatorSample));
+    return ((int16_t)carrierSample + operator3Sample) >> 1;
+  }
+};
+#endif
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::nextSample()
+ * returns the next sample of the voice before it's scaled for output, from OPERATORS operators routed by
+ * FM_ALGORITHM.  8 bits
+ *----------------------------------------------------------------------------------------------------------
+ */
+template <uint8_t OPERATORS>
+inline int16_t MutatingFM::nextSample()
+{
+  // master gain is already folded into the gain by updateControl()
+  int8_t carrierSample = FMAlgorithm<FM_ALGORITHM, OPERATORS>::next(*this);
+
+  return ((int16_t)carrierSample * nextGain()) >> 8;
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::updateAudio()
+ * returns the next audio sample
+ * defined here rather than in avSourceFM.cpp so the sketch's updateAudio() can inline it
+ *----------------------------------------------------------------------------------------------------------
+ */
+template <uint8_t OPERATORS>
+inline int MutatingFM::updateAudio()
+{
+  return MonoOutput::fromNBit(9, nextSample<OPERATORS>());
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::updateAudioPair()
+ * returns the next audio sample of two voices mixed together
+ * fused version of fromNBit(9, voiceA.updateAudio() + voiceB.updateAudio()) - the modulator & carrier
+ * table reads of the two voices are interleaved and the mix is scaled once.  each voice is still shifted
+ * down from 9 bits before the sum so the rounding, and the output, is bit-identical to the separate calls
+ * with FM_OPERATORS each voice runs its whole algorithm in turn
+ *----------------------------------------------------------------------------------------------------------
+ */
+template <uint8_t OPERATORS_A, uint8_t OPERATORS_B>
+inline int MutatingFM::updateAudioPair(MutatingFM& voiceA, MutatingFM& voiceB)
+{
+  #if FM_OPERATORS > 2
+  int8_t  carrierA   = FMAlgorithm<FM_ALGORITHM, OPERATORS_A>::next(voiceA);
+  int8_t  carrierB   = FMAlgorithm<FM_ALGORITHM, OPERATORS_B>::next(voiceB);
+  #else
+  int8_t  modulatorA = voiceA.nextModulatorSample();
+  int8_t  modulatorB = voiceB.nextModulatorSample();
+  int8_t  carrierA   = voiceA.nextCarrierSample(voiceA.nextPhaseModulation(modulatorA));
+  int8_t  carrierB   = voiceB.nextCarrierSample(voiceB.nextPhaseModulation(modulatorB));
+  #endif
+
+  return MonoOutput::fromNBit(9, SCALE_AUDIO(((int16_t)carrierA * voiceA.nextGain()) >> 8, 9)
+                               + SCALE_AUDIO(((int16_t)carrierB * voiceB.nextGain()) >> 8, 9));
+}
+
+
+
+
+#ifdef ENABLE_SOFT_CLIP_MIXER
+/*----------------------------------------------------------------------------------------------------------
+ * softClipVoiceMix()
+ * returns the 8 bit output for a 9 bit mix of the voices (-256 to 255), read from the saturation curve
+ * in softclip512_int8.h - linear for quiet mixes, rounding off into full scale rather than clipping
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int8_t softClipVoiceMix(int16_t mix)
+{
+  return FLASH_OR_RAM_READ<const int8_t>(SOFTCLIP512_DATA + (mix + 256));
+}
+#endif
+
 #endif
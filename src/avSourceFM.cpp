@@ -22,74 +22,108 @@
 #include <ADSR.h>
 #include <IntMap.h>
 #include "avSource.h"
+#include "fmratio_uint32.h" // modulator frequency ratios for setFreqs()
+#include "tuning.h" // carrier phase increments for setFreqs()
 #include "MutantFMSynthOptions.h"
 
-//making LFO update rate lower than control rate to save processing.  places upper limit on LFO frequency
-#define LFO_OSCILLATOR_UPDATE_RATE 64
-
-// voice 1
-Oscil <SIN2048_NUM_CELLS, AUDIO_RATE> carrier1(SIN2048_DATA);
-Oscil <SIN2048_NUM_CELLS, AUDIO_RATE> modulator1(SIN2048_DATA);
-ADSR <CONTROL_RATE, CONTROL_RATE> envelopeAmp1;
-ADSR <CONTROL_RATE, CONTROL_RATE> envelopeMod1;
-Oscil <SIN2048_NUM_CELLS, LFO_OSCILLATOR_UPDATE_RATE> lfo1(SIN2048_DATA); 
+#if AUDIO_RATE != TUNING_AUDIO_RATE || SIN2048_NUM_CELLS != TUNING_TABLE_CELLS
+#error the tuning table needs regenerating for this AUDIO_RATE & table size
+#endif
 
-// voice 2
-Oscil <SIN2048_NUM_CELLS, AUDIO_RATE> carrier2(SIN2048_DATA);
-Oscil <SIN2048_NUM_CELLS, AUDIO_RATE>modulator2(SIN2048_DATA);
-ADSR <CONTROL_RATE, CONTROL_RATE> envelopeAmp2;
-ADSR <CONTROL_RATE, CONTROL_RATE> envelopeMod2;
-Oscil <SIN2048_NUM_CELLS, LFO_OSCILLATOR_UPDATE_RATE> lfo2(SIN2048_DATA);  
+// the oscillators are templated on WAVETABLE_NUM_CELLS, so every waveform table must have that many cells 
+// (see host/wavetables/wavetables.txt)
+static_assert(sizeof(WAVETABLE_NULL_DATA) == WAVETABLE_NUM_CELLS, "waveform tables must have WAVETABLE_NUM_CELLS cells");
 
+/*----------------------------------------------------------------------------------------------------------
+ * waveformBank
+ * the table & variant for each WAVEFORM_*, shared by the carrier, modulator & LFO
+ * reverse saw is the inverted saw.  square is the sign of the saw, which is negative for the first half 
+ * of the cycle, flipped to 127 / -128 - exactly the square table it replaced
+ * noise has no table, it's generated by nextNoise().  its oscillator reads the zero table
+ *----------------------------------------------------------------------------------------------------------
+ */
+static const WaveformBankEntry waveformBank[MAX_WAVEFORMS] PROGMEM = 
+{
+  {WAVETABLE_SIN_DATA,              {0x00, 0x00}},
+  {WAVETABLE_SAW_DATA,              {0x00, 0x00}},
+  {WAVETABLE_SAW_DATA,              {0x00, 0xFF}},    // reverse saw
+  {WAVETABLE_SAW_DATA,              {0xFF, 0x80}},    // square
+  #ifdef INTERPOLATED_WAVETABLE_CELLS
+  {WAVETABLE_DATA(TRIANGLE),        {0x00, 0x00}},
+  {WAVETABLE_DATA(PULSEQUARTER),    {0x00, 0x00}},
+  {WAVETABLE_DATA(PULSEEIGHTH),     {0x00, 0x00}},
+  {WAVETABLE_DATA(SINEOCTAVE),      {0x00, 0x00}},
+  {WAVETABLE_DATA(SINETWELFTH),     {0x00, 0x00}},
+  {WAVETABLE_DATA(ORGAN),           {0x00, 0x00}},
+  {WAVETABLE_DATA(HOLLOW),          {0x00, 0x00}},
+  {WAVETABLE_DATA(FORMANT),         {0x00, 0x00}},
+  {WAVETABLE_DATA(METALLIC),        {0x00, 0x00}},
+  {WAVETABLE_DATA(SOFTSAW),         {0x00, 0x00}},
+  #endif
+  {WAVETABLE_NULL_DATA,             {0x00, 0x00}},    // noise
+  {WAVETABLE_NULL_DATA,             {0x00, 0x00}}     // off
+};
 
+#if FM_OPERATORS > 2 && FM_OPERATOR_VOICES == 1
+OperatorOscil MutatingFM::operators[FM_OPERATORS - 2];
+uint16_t      MutatingFM::operatorAmount;
+#endif
 
 /*----------------------------------------------------------------------------------------------------------
  * MutatingFM::MutatingFM()
  * create a new instance
+ * operatorCount is the operators it plays, FM_OPERATORS_VOICE0 or _VOICE1 - see playsOperators()
  *----------------------------------------------------------------------------------------------------------
  */
-MutatingFM::MutatingFM()
+MutatingFM::MutatingFM(uint8_t operatorCount) : carrier(WAVETABLE_SIN_DATA), modulator(WAVETABLE_SIN_DATA), lfo(WAVETABLE_SIN_DATA)
 {
-  masterGain          = 255;
-  masterGainBitShift  = 8;
-  setOscillator(0);
+  #if FM_OPERATORS > 2 && FM_OPERATOR_VOICES == 1
+  // before setFreqs(), which only updates the operators if the voice owns them
+  ownsOperators = operatorCount > 2;
+  #else
+  // every voice plays FM_OPERATORS operators
+  (void)operatorCount;
+  #endif
+
+  // a different seed for every noise source so the voices & operators don't play the same noise
+  static uint16_t noiseSeed = 0xACE1;
+
+  lfoNoise.state        = (noiseSeed += 0x3C5B) | 1;
+  carrierNoise.state    = (noiseSeed += 0x3C5B) | 1;
+  modulatorNoise.state  = (noiseSeed += 0x3C5B) | 1;
+
+  setGain(255);
+  lfo.setFreq((float)0.02);
   setFreqs(33);
   updateCount = 0;
-  envelopeMod->setADLevels(255,0);
+  envelopeMod.setADLevels(255,0);
   param[SYNTH_PARAMETER_MOD_AMOUNT_LFODEPTH] = 0;
-}
-
 
+  #ifdef ENABLE_WAVETABLE_MORPH
+  // the carrier reads the morph table from here on
+  carrierMorph = 0;
+  setCarrierTable();
+  #endif
 
-/*----------------------------------------------------------------------------------------------------------
- * MutatingFM::setOscillator()
- * links this object instance to a given statically defined oscillator, envelope etc
- * terrible design pattern but I had compilation issues when these variables were declared in the class def where they belong
- *----------------------------------------------------------------------------------------------------------
- */
-void MutatingFM::setOscillator(uint8_t oscIndex)
-{
-  switch (oscIndex)
+  #if FM_OPERATORS > 2
+  // a 2:1 ratio in the exponential FM mode, and silent until Func + depth is turned up
+  param[SYNTH_PARAMETER_OPERATOR_RATIO] = 488;
+  if (playsOperators())
   {
-    case 1:
-      carrier     = &carrier2;
-      modulator   = &modulator2;
-      envelopeAmp = &envelopeAmp2;
-      envelopeMod = &envelopeMod2;
-      lfo         = &lfo2;
-      break;
-
-    case 0: 
-    default:
-      carrier     = &carrier1;
-      modulator   = &modulator1;
-      envelopeAmp = &envelopeAmp1;
-      envelopeMod = &envelopeMod1;
-      lfo         = &lfo1;
-      break;
+    for (uint8_t i = 0; i < FM_OPERATORS - 2; i++)
+    {
+      operators[i].setTable(WAVETABLE_SIN_DATA);
+    }
+    operatorAmount = 0;
+    setFreqs(0);
   }
+  #endif
 
-  lfo->setFreq((float)0.02);
+  #ifdef ENABLE_MODULATOR_FEEDBACK
+  modulatorFeedback       = 0;
+  modulatorFeedbackSample = 0;
+  lastModulatorSample     = 0;
+  #endif
 }
 
 
@@ -100,7 +134,7 @@ void MutatingFM::setOscillator(uint8_t oscIndex)
  * currently velocity is ignored
  *----------------------------------------------------------------------------------------------------------
  */
-int MutatingFM::noteOn(byte pitch, byte velocity, unsigned int length)
+int MutatingFM::noteOn(uint8_t pitch, uint8_t velocity, uint16_t length)
 {
   #ifndef ENABLE_MIDI_OUTPUT
   
@@ -114,23 +148,23 @@ int MutatingFM::noteOn(byte pitch, byte velocity, unsigned int length)
   {
     if (length != lastNoteLength)
     {
-      envelopeAmp->setTimes(0,length,0,50);
-      envelopeAmp->setADLevels(255,200);
+      envelopeAmp.setTimes(0,length,0,50);
+      envelopeAmp.setADLevels(255,200);
     }
-    envelopeAmp->noteOn(false); 
+    envelopeAmp.noteOn(false); 
 
     // setup modulation envelope attack, decay time based on parameters
     if (param[SYNTH_PARAMETER_ENVELOPE_ATTACK] < MIN_MODULATION_ENV_TIME)
     {
-      envelopeMod->setTimes(0,param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,length,50);
+      envelopeMod.setTimes(0,param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,length,50);
     }
     else
     {
-      envelopeMod->setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,length,50);
+      envelopeMod.setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,length,50);
     }
 
     setFreqs(pitch);
-    envelopeMod->noteOn(true);
+    envelopeMod.noteOn(true);
 
     #ifndef ENABLE_MIDI_OUTPUT
     
@@ -163,38 +197,27 @@ int MutatingFM::noteOn(byte pitch, byte velocity, unsigned int length)
  */
 int MutatingFM::noteOff()
 {
-  envelopeAmp->noteOff(); 
+  envelopeAmp.noteOff(); 
   return 0;
 
 }
 
 
-/*----------------------------------------------------------------------------------------------------------
- * MutatingFM::updateAudio()
- * returns the next audio sample
- *----------------------------------------------------------------------------------------------------------
- */
-inline int MutatingFM::updateAudio()
-{
-  // TODO:  ignores master gain due to audio glitches when shifting by a variable rather than a constant
-  //        optimise and reinstate
-  //return MonoOutput::fromNBit(9, (((int16_t)carrier->phMod(modulatorAmount * modulator->next() >> 8) * currentGain) >> masterGainBitShift));
-
-  // return audio without master gain
-  return MonoOutput::fromNBit(9, (((int16_t)carrier->phMod(modulatorAmount * modulator->next() >> 8) * currentGain) >> 8));
-}
-
-
-
-
-
 /*----------------------------------------------------------------------------------------------------------
  * MutatingFM::updateControl()
  * updates the envelopes and modulation control
  *----------------------------------------------------------------------------------------------------------
  */
-inline void MutatingFM::updateControl()
+void MutatingFM::updateControl()
 {
+  int8_t  lfoSample;
+  uint8_t modulationLevel;
+
+  #ifdef ENABLE_AUDIO_RATE_RAMPS
+  uint8_t lastGain            = currentGain;
+  Q16n16  lastModulatorAmount = modulatorAmount;
+  #endif
+
   #ifdef SYNTH_MODULATION_UPDATE_DIVIDER
   // CONTROL_RATE has to be high to reduce jitter in the sequencer but running these calcs at 128hz seems to be too high, so only do it every 2nd call
   if (++updateCount % SYNTH_MODULATION_UPDATE_DIVIDER == 0)
@@ -203,22 +226,74 @@ inline void MutatingFM::updateControl()
 
     // update amplitude & modulation envelopes
     // 20-30 micros
-    envelopeAmp->update();
-    envelopeMod->update();
+    envelopeAmp.update();
+    envelopeMod.update();
 
   #ifdef SYNTH_MODULATION_UPDATE_DIVIDER
   }
   #endif
 
-    // store gain for use in updateAudio
-    currentGain     = envelopeAmp->next();  
+    // store gain for use in updateAudio, scaled by the master gain so the audio path is a single 8x8 multiply
+    // gain level 255 multiplies by 256/256 so full volume leaves the envelope unchanged
+    currentGain     = ((uint16_t)envelopeAmp.next() * ((uint16_t)masterGainLevel + 1)) >> 8;
 
     // store LFO value for use in displaying the lfo position onscreen.
-    lastLFOValue    = lfo->next()+128;
+    // noise is sampled & held, changing each time the LFO phase moves on a segment
+    lfoSample       = applyWaveformVariant(lfo.next(), lfoVariant);
+    if (lfoWaveform == WAVEFORM_NOISE)
+    {
+      lfoSample     = nextNoise(lfoNoise, lfo.getPhaseFractional());
+    }
+    lastLFOValue    = lfoSample+128;
 
-    modulatorAmount = ((((uint32_t)param[SYNTH_PARAMETER_MOD_AMOUNT])          * (uint32_t)envelopeMod->next())
+    modulationLevel = envelopeMod.next();
+    modulatorAmount = ((((uint32_t)param[SYNTH_PARAMETER_MOD_AMOUNT])          * (uint32_t)modulationLevel)
                       + (((uint32_t)param[SYNTH_PARAMETER_MOD_AMOUNT_LFODEPTH]) * (uint32_t)lastLFOValue)
                       );
+
+    #if FM_OPERATORS > 2
+    // the extra operators follow the modulation envelope too
+    if (playsOperators())
+    {
+      operatorAmount = ((uint32_t)param[SYNTH_PARAMETER_OPERATOR_AMOUNT] * modulationLevel) >> 8;
+    }
+    #endif
+
+    #ifdef ENABLE_WAVETABLE_MORPH
+    // knob position plus LFO, both 0-1023, scaled to 0-255 and held at the next waveform, then quantised to 
+    // 16 steps, 0-255 in 17s, so the table is only rebuilt when the morph moves to another step
+    uint16_t morph  = (param[SYNTH_PARAMETER_CARRIER_MORPH]
+                      + (((uint32_t)param[SYNTH_PARAMETER_CARRIER_MORPH_LFODEPTH] * lastLFOValue) >> 8)
+                      ) >> 2;
+    morph           = ((morph > 255 ? 255 : morph) >> CARRIER_MORPH_STEP_SHIFT) * (255 / (255 >> CARRIER_MORPH_STEP_SHIFT));
+
+    if (morph != carrierMorph)
+    {
+      carrierMorph  = morph;
+      fillCarrierMorphTable();
+    }
+    #endif
+
+    #ifdef ENABLE_MODULATOR_FEEDBACK
+    // knob 0-1023 to the 0-255 the audio path multiplies by
+    modulatorFeedback = param[SYNTH_PARAMETER_MODULATOR_FEEDBACK] >> 2;
+    #endif
+
+    #ifdef ENABLE_16BIT_MODULATION_INDEX
+    // round to 16 bits here so the audio path multiplies 16x8 instead of 32x8
+    modulationIndex = (modulatorAmount + 128) >> 8;
+    #endif
+
+    #ifdef ENABLE_AUDIO_RATE_RAMPS
+    // restart the ramps from the last tick's values so rounding in the steps never accumulates
+    // the gain ramp lands exactly on currentGain after 2^AUDIO_RAMP_SHIFT samples, the modulation ramp within 
+    // 2^AUDIO_RAMP_SHIFT of modulatorAmount
+    gainRamp                = (uint16_t)lastGain << 8;
+    gainRampStep            = ((int16_t)currentGain - (int16_t)lastGain) * (256 >> AUDIO_RAMP_SHIFT);
+    modulatorAmountRamp     = lastModulatorAmount;
+    modulatorAmountRampStep = ((int32_t)modulatorAmount - (int32_t)lastModulatorAmount) / (1 << AUDIO_RAMP_SHIFT);
+    #endif
+
     #ifndef ENABLE_MIDI_OUTPUT
 
     //Serial.println(Q16n16_to_float(modulatorAmount));
@@ -231,101 +306,148 @@ inline void MutatingFM::updateControl()
 /*----------------------------------------------------------------------------------------------------------
  * MutatingFM::setGain()
  * sets the gain 
- * stores it as a 0-255 byte and also as a bitshift value of gain reduction 8 (max volume) - 17 (off)
+ * stores it as a 0-255 byte and also as a 0-255 level from the gain curve table, applied to the 
+ * amplitude envelope in updateControl()
  *----------------------------------------------------------------------------------------------------------
  */
 void MutatingFM::setGain(byte gain)
 {
-  masterGain = gain;
-
-  if (masterGain == 0)
-  {
-    masterGainBitShift = 17;
-  }
-  else
-  {
-    masterGainBitShift = 8 + (((uint16_t)264 - (uint16_t)masterGain) >> 5);
-  }
+  masterGain      = gain;
+  masterGainLevel = FLASH_OR_RAM_READ<const uint8_t>(GAINCURVE256_DATA + gain);
 }
 
 
 
 
 /*----------------------------------------------------------------------------------------------------------
- * MutatingFM::setFreqs()
- * calculates the frequencies based on the current parameters
+ * multiplyRatio
+ * multiplies a phase increment by a Q8n24 or Q0n32 ratio (ratioBits = 24 or 32), rounding down
+ * built from 16x16 bit multiplies, which are much cheaper on AVR than a 64 bit product.  
+ * the increment must be under 2^30, the ratio under 16 and the result under 2^32
  *----------------------------------------------------------------------------------------------------------
  */
-void MutatingFM::setFreqs(uint8_t midiNote) 
+static inline uint32_t multiplyRatio(uint32_t phaseIncrement, uint32_t ratio, uint8_t ratioBits)
 {
-  uint8_t multIndex;
-  float freqshift[17] = {0,0.03125,0.0625,0.125,0.25,0.5,1,1.5,2,2.5,3,3.5,4,5,6,7,8};
+  uint16_t incrementHigh  = phaseIncrement >> 16;
+  uint16_t incrementLow   = phaseIncrement;
+  uint16_t ratioHigh      = ratio >> 16;
+  uint16_t ratioLow       = ratio;
 
+  uint32_t middle = (uint32_t)incrementHigh * ratioLow
+                  + (uint32_t)incrementLow  * ratioHigh
+                  + (((uint32_t)incrementLow * ratioLow) >> 16);
 
-  if(midiNote != lastMidiNote && midiNote != 0)
-  {
-    carrierFrequency  = Q16n16_mtof(Q8n0_to_Q16n16(midiNote));
-    carrier->setFreq_Q16n16(carrierFrequency);
-    lastMidiNote = midiNote;
-  }
+  return ((uint32_t)incrementHigh * ratioHigh << (32 - ratioBits)) + (middle >> (ratioBits - 16));
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::getModulatorPhaseIncrement()
+ * calculates the modulator's phase increment from the carrier's, the FM mode & MOD_RATIO parameter
+ * integer only - the ratios come from fmratio_uint32.h or are calculated from the FMRATIO_LINEAR_* constants
+ *----------------------------------------------------------------------------------------------------------
+ */
+uint32_t MutatingFM::getModulatorPhaseIncrement(uint32_t carrierPhaseIncrement, uint8_t fmMode, uint16_t modRatio)
+{
+  uint8_t multIndex;
+  uint32_t ratio;
 
   // added EXPONENTIAL & LINEAR FM modes - exponential is fixed to defined multiples
   // LINEAR is carrier * value with two ranges
   switch(fmMode)
   {
     case FM_MODE_EXPONENTIAL:
-      lastParam[SYNTH_PARAMETER_MOD_RATIO] = param[SYNTH_PARAMETER_MOD_RATIO];
-
-      multIndex = param[SYNTH_PARAMETER_MOD_RATIO]/61;//(1023/17);
+      multIndex = modRatio/61;//(1023/17);
 
       if (multIndex>0)
       {
-        modulationFrequency = carrierFrequency * freqshift[multIndex];
-      }
-      else
-      {
-        modulationFrequency = carrierFrequency*((float)1.0 / ((512-param[SYNTH_PARAMETER_MOD_RATIO])+1));
+        ratio = FLASH_OR_RAM_READ<const uint32_t>(FMRATIO_EXPONENTIAL_DATA + multIndex);
+        return multiplyRatio(carrierPhaseIncrement, ratio, 24);
       }
-      break;
+
+      // 1 / ((512-ratio)+1)
+      ratio = FLASH_OR_RAM_READ<const uint32_t>(FMRATIO_SUBHARMONIC_DATA + modRatio);
+      return multiplyRatio(carrierPhaseIncrement, ratio, 32);
 
     case FM_MODE_LINEAR_HIGH:
-      modulationFrequency = carrierFrequency*(float)param[SYNTH_PARAMETER_MOD_RATIO]/100;// carrierFrequency*((float)1.0 / ((512-param[SYNTH_PARAMETER_MOD_RATIO])+1));
-      break;
+      // ratio / 100
+      ratio = ((uint32_t)modRatio * FMRATIO_LINEAR_HIGH + 8) >> 4;
+      return multiplyRatio(carrierPhaseIncrement, ratio, 24);
 
     case FM_MODE_LINEAR_LOW:
-      modulationFrequency = carrierFrequency*(float)param[SYNTH_PARAMETER_MOD_RATIO]/10000;// carrierFrequency*((float)1.0 / ((512-param[SYNTH_PARAMETER_MOD_RATIO])+1));
-      break;
-
-    case FM_MODE_FREE:
-      modulationFrequency = (uint32_t)param[SYNTH_PARAMETER_MOD_RATIO] << 17; //0-1023 << 17 into a Q16n16 value = 0-2000hz
-      break;
+      // ratio / 10000
+      ratio = (uint32_t)modRatio * FMRATIO_LINEAR_LOW;
+      return multiplyRatio(carrierPhaseIncrement, ratio, 32);
   }
 
-  modulator->setFreq_Q16n16(modulationFrequency);
+  // FM_MODE_FREE
+  // 0-1023 << 17 into a Q16n16 value = 0-2000hz, converted to a phase increment
+  return ((uint32_t)modRatio << 17) / (AUDIO_RATE / SIN2048_NUM_CELLS);
+}
 
 
 
-/*
-  #ifndef ENABLE_MIDI_OUTPUT
-  
-  if (midiNote != 0)
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::setFreqs()
+ * calculates the frequencies based on the current parameters
+ *----------------------------------------------------------------------------------------------------------
+ */
+void MutatingFM::setFreqs(uint8_t midiNote) 
+{
+  if(midiNote != lastMidiNote && midiNote != 0)
   {
-    if (carrier == &carrier1)
+    // octave shift, spread & the track offset can take a note past the table - fold it down by octaves
+    uint8_t tuningNote = midiNote;
+    while (tuningNote >= TUNING_NUM_CELLS)
     {
-      Serial.print(F("OSC1:  "));
+      tuningNote -= TUNING_NOTES_PER_OCTAVE;
     }
-    else
+
+    carrierPhaseIncrement = FLASH_OR_RAM_READ<const uint32_t>(TUNING_PHASEINC_DATA + tuningNote);
+    carrier.setPhaseInc(carrierPhaseIncrement);
+    lastMidiNote = midiNote;
+
+    #ifdef ENABLE_BANDLIMITED_WAVETABLES
+    // the band-limited table for the new note's octave
+    setCarrierTable();
+    #endif
+  }
+
+  if (fmMode == FM_MODE_EXPONENTIAL)
+  {
+    lastParam[SYNTH_PARAMETER_MOD_RATIO] = param[SYNTH_PARAMETER_MOD_RATIO];
+  }
+
+  modulatorPhaseIncrement = getModulatorPhaseIncrement(carrierPhaseIncrement, fmMode, param[SYNTH_PARAMETER_MOD_RATIO]);
+  modulator.setPhaseInc(modulatorPhaseIncrement);
+
+  #if FM_OPERATORS > 2
+  // the extra operators all play at SYNTH_PARAMETER_OPERATOR_RATIO of the carrier
+  if (playsOperators())
+  {
+    uint32_t operatorPhaseIncrement = getModulatorPhaseIncrement(carrierPhaseIncrement, fmMode, param[SYNTH_PARAMETER_OPERATOR_RATIO]);
+
+    for (uint8_t i = 0; i < FM_OPERATORS - 2; i++)
     {
-      Serial.print(F("OSC2:  "));
+      operators[i].setPhaseInc(operatorPhaseIncrement);
     }
+  }
+  #endif
+
 
 
+/*
+  #ifndef ENABLE_MIDI_OUTPUT
+  
+  if (midiNote != 0)
+  {
     Serial.print(F("set frequency note="));
     Serial.print(midiNote);
-    Serial.print(F(", carrier="));
-    Serial.print(Q16n16_to_float(carrierFrequency));
-    Serial.print(F(", modfreq="));
-    Serial.print(Q16n16_to_float(modulationFrequency));
+    Serial.print(F(", carrier inc="));
+    Serial.print(carrierPhaseIncrement);
+    Serial.print(F(", modulator inc="));
+    Serial.print(modulatorPhaseIncrement);
     Serial.println();
   }
   #endif
@@ -335,6 +457,96 @@ void MutatingFM::setFreqs(uint8_t midiNote)
 
 
 
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::setCarrierTable()
+ * points the carrier at the table & variant for its waveform, or with ENABLE_WAVETABLE_MORPH at its morph
+ * table, rebuilt for the new waveform
+ *----------------------------------------------------------------------------------------------------------
+ */
+void MutatingFM::setCarrierTable()
+{
+  #ifdef ENABLE_WAVETABLE_MORPH
+  carrier.setTable(carrierMorphTable);
+  fillCarrierMorphTable();
+  #else
+  carrier.setTable(getCarrierWaveformTable(carrierWaveform, carrierVariant));
+  #endif
+}
+
+
+
+#ifdef ENABLE_WAVETABLE_MORPH
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::fillCarrierMorphTable()
+ * fills carrierMorphTable with the carrier's waveform crossfaded towards the next in the bank by carrierMorph/256
+ * 512-cell tables are read every other cell.  called at control rate, only when the morph, waveform or 
+ * band-limited octave changes, so the carrier reads a single table per sample
+ *----------------------------------------------------------------------------------------------------------
+ */
+void MutatingFM::fillCarrierMorphTable()
+{
+  WaveformVariant nextVariant;
+  const int8_t*   table     = getCarrierWaveformTable(carrierWaveform, carrierVariant);
+  const int8_t*   nextTable = getCarrierWaveformTable((carrierWaveform + 1) % MAX_CARRIER_WAVEFORMS, nextVariant);
+
+  for (uint16_t i = 0; i < CARRIER_MORPH_TABLE_CELLS; i++)
+  {
+    uint16_t  cell        = i * (WAVETABLE_NUM_CELLS / CARRIER_MORPH_TABLE_CELLS);
+    int8_t    sample      = applyWaveformVariant(FLASH_OR_RAM_READ<const int8_t>(table + cell), carrierVariant);
+    int8_t    nextSample  = applyWaveformVariant(FLASH_OR_RAM_READ<const int8_t>(nextTable + cell), nextVariant);
+
+    // the difference is at most 255, so times an 8 bit fraction it fits in 16 bits
+    carrierMorphTable[i]  = sample + (((int16_t)(nextSample - sample) * carrierMorph) >> 8);
+  }
+}
+#endif
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * MutatingFM::getCarrierWaveformTable()
+ * returns the table for a carrier waveform and sets the variant to apply to it
+ * with ENABLE_BANDLIMITED_WAVETABLES, saw, reverse saw & square read the band-limited table for the carrier's 
+ * octave, which has no harmonics above Nyquist.  the square has tables of its own as the sign of a band-limited 
+ * saw is a plain square again
+ *----------------------------------------------------------------------------------------------------------
+ */
+const int8_t* MutatingFM::getCarrierWaveformTable(uint8_t waveform, WaveformVariant& variant)
+{
+  const int8_t* table = getWaveformTable(waveform);
+
+  variant = getWaveformVariant(waveform);
+
+  #ifdef ENABLE_BANDLIMITED_WAVETABLES
+  uint32_t  octaves = carrierPhaseIncrement >> BANDLIMITED_LEVEL_SHIFT;
+  uint8_t   level   = 0;
+
+  while (octaves && level < WAVETABLE_BANDLIMITED_LEVELS - 1)
+  {
+    octaves >>= 1;
+    level++;
+  }
+
+  switch (waveform)
+  {
+    case WAVEFORM_SAW: 
+    case WAVEFORM_REVSAW: 
+      table = WAVETABLE_SAW_BANDLIMITED_DATA[level];
+      break;
+
+    case WAVEFORM_SQUARE: 
+      table = WAVETABLE_SQUARE_BANDLIMITED_DATA[level];
+      variant.squareMask = 0x00;
+      variant.invertMask = 0x00;
+      break;
+  }
+  #endif
+
+  return table;
+}
+
+
+
 /*----------------------------------------------------------------------------------------------------------
  * MutatingPhasor::setFilterShape()
  * 
@@ -419,26 +631,32 @@ void MutatingFM::setParam(uint8_t paramIndex, uint16_t newValue)
       case SYNTH_PARAMETER_MOD_RATIO:
         setFreqs(0);
         break;
+
+      #if FM_OPERATORS > 2
+      case SYNTH_PARAMETER_OPERATOR_RATIO:
+        setFreqs(0);
+        break;
+      #endif
       
       case SYNTH_PARAMETER_MOD_AMOUNT:
-        envelopeMod->setADLevels(param[SYNTH_PARAMETER_MOD_AMOUNT] >> 2,0);
+        envelopeMod.setADLevels(param[SYNTH_PARAMETER_MOD_AMOUNT] >> 2,0);
         break;
 
       case SYNTH_PARAMETER_ENVELOPE_SHAPE:
         setModulationShape(newValue);
-        envelopeMod->setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,lastNoteLength,50);
+        envelopeMod.setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,lastNoteLength,50);
         break;
 
       case SYNTH_PARAMETER_ENVELOPE_ATTACK:
-        envelopeMod->setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,lastNoteLength,50);
+        envelopeMod.setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,lastNoteLength,50);
         break;
 
       case SYNTH_PARAMETER_ENVELOPE_DECAY:
-        envelopeMod->setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,lastNoteLength,50);
+        envelopeMod.setTimes(param[SYNTH_PARAMETER_ENVELOPE_ATTACK],param[SYNTH_PARAMETER_ENVELOPE_DECAY]+MIN_MODULATION_ENV_TIME,lastNoteLength,50);
         break;
 
       case SYNTH_PARAMETER_ENVELOPE_SUSTAIN:
-        envelopeMod->setSustainLevel(param[SYNTH_PARAMETER_ENVELOPE_SUSTAIN] >> 2);
+        envelopeMod.setSustainLevel(param[SYNTH_PARAMETER_ENVELOPE_SUSTAIN] >> 2);
         break;
 
     }
@@ -481,6 +699,34 @@ uint8_t MutatingFM::getFMMode()
 }
 
 
+/*----------------------------------------------------------------------------------------------------------
+ * getWaveformTable
+ * returns the wavetable for a WAVEFORM_* value from the waveform bank.  used for the carrier, modulator & LFO
+ *----------------------------------------------------------------------------------------------------------
+ */
+const int8_t* MutatingFM::getWaveformTable(uint8_t waveform)
+{
+  return (const int8_t*)pgm_read_ptr(&waveformBank[waveform % MAX_WAVEFORMS].table);
+}
+
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * getWaveformVariant
+ * returns how to change the samples read from getWaveformTable() for a WAVEFORM_* value
+ *----------------------------------------------------------------------------------------------------------
+ */
+WaveformVariant MutatingFM::getWaveformVariant(uint8_t waveform)
+{
+  WaveformVariant variant;
+
+  variant.squareMask = pgm_read_byte(&waveformBank[waveform % MAX_WAVEFORMS].variant.squareMask);
+  variant.invertMask = pgm_read_byte(&waveformBank[waveform % MAX_WAVEFORMS].variant.invertMask);
+  return variant;
+}
+
+
+
 /*----------------------------------------------------------------------------------------------------------
  * toggleCarrierWaveform
  * Sets the carrier waveform 
@@ -492,38 +738,7 @@ void MutatingFM::toggleCarrierWaveform()
 {
   carrierWaveform = (carrierWaveform + 1) % MAX_CARRIER_WAVEFORMS;
   
-  switch (carrierWaveform)
-  {
-    case WAVEFORM_SIN: 
-      carrier->setTable(SIN2048_DATA);
-      break;
-
-    case WAVEFORM_SAW: 
-      carrier->setTable(SAW2048_DATA);
-      break;
-
-    case WAVEFORM_REVSAW: 
-      carrier->setTable(REVSAW2048_DATA);
-      break;
-
-    case WAVEFORM_SQUARE: 
-      carrier->setTable(SQUARE2048_DATA);
-      break;
-
-/** @brief if COMPILE_SMALLER_BINARY flag is defined, omit the pseudorandom waveform */
-#ifndef COMPILE_SMALLER_BINARY
-    case WAVEFORM_PSEUDORANDOM: 
-      carrier->setTable(PSEUDORANDOM2048_DATA);
-      break;
-#endif
-
-    case WAVEFORM_NULL: 
-      carrier->setTable(NULLWAVEFORM2048_DATA);
-      break;
-
-    default:
-      carrier->setTable(SIN2048_DATA);
-  }
+  setCarrierTable();
 }
 
 
@@ -551,38 +766,8 @@ void MutatingFM::toggleModulatorWaveform()
 {
   modulatorWaveform = (modulatorWaveform + 1) % MAX_MODULATOR_WAVEFORMS;
   
-  switch (modulatorWaveform)
-  {
-    case WAVEFORM_SIN: 
-      modulator->setTable(SIN2048_DATA);
-      break;
-
-    case WAVEFORM_SAW: 
-      modulator->setTable(SAW2048_DATA);
-      break;
-
-    case WAVEFORM_REVSAW: 
-      modulator->setTable(REVSAW2048_DATA);
-      break;
-
-    case WAVEFORM_SQUARE: 
-      modulator->setTable(SQUARE2048_DATA);
-      break;
-
-/** @brief if COMPILE_SMALLER_BINARY flag is defined, omit the pseudorandom waveform */
-#ifndef COMPILE_SMALLER_BINARY
-    case WAVEFORM_PSEUDORANDOM: 
-      modulator->setTable(PSEUDORANDOM2048_DATA);
-      break;
-#endif
-
-    case WAVEFORM_NULL: 
-      modulator->setTable(NULLWAVEFORM2048_DATA);
-      break;
-
-    default:
-      modulator->setTable(SIN2048_DATA);
-  }
+  modulator.setTable(getWaveformTable(modulatorWaveform));
+  modulatorVariant = getWaveformVariant(modulatorWaveform);
 }
 
 
@@ -609,38 +794,8 @@ void MutatingFM::toggleLFOWaveform()
 {
   lfoWaveform = (lfoWaveform + 1) % MAX_LFO_WAVEFORMS;
   
-  switch (lfoWaveform)
-  {
-    case WAVEFORM_SIN: 
-      lfo->setTable(SIN2048_DATA);
-      break;
-
-    case WAVEFORM_SAW: 
-      lfo->setTable(SAW2048_DATA);
-      break;
-
-    case WAVEFORM_REVSAW: 
-      lfo->setTable(REVSAW2048_DATA);
-      break;
-
-    case WAVEFORM_SQUARE: 
-      lfo->setTable(SQUARE2048_DATA);
-      break;
-
-/** @brief if COMPILE_SMALLER_BINARY flag is defined, omit the pseudorandom waveform */
-#ifndef COMPILE_SMALLER_BINARY
-    case WAVEFORM_PSEUDORANDOM: 
-      lfo->setTable(PSEUDORANDOM2048_DATA);
-      break;    
-#endif
-
-    case WAVEFORM_NULL: 
-      lfo->setTable(NULLWAVEFORM2048_DATA);
-      break;
-
-    default:
-      lfo->setTable(SIN2048_DATA);
-  }
+  lfo.setTable(getWaveformTable(lfoWaveform));
+  lfoVariant = getWaveformVariant(lfoWaveform);
 }
 
 
@@ -689,7 +844,7 @@ uint8_t MutatingFM::getLFOValue()
  */
 void MutatingFM::setLFOFrequency(float freq)
 {
-  lfo->setFreq_Q16n16(float_to_Q16n16(freq));
+  lfo.setFreq_Q16n16(float_to_Q16n16(freq));
 }
 
 
@@ -0,0 +1,55 @@
+/*
+  fmratio_uint32.h - defines the modulator:carrier frequency ratios used by MutatingFM::getModulatorPhaseIncrement()
+
+  ratios are unsigned fixed point so the modulator frequency is an integer multiply of the carrier frequency.
+  ratios of 1 or more are Q8n24 (value / 2^24), ratios under 1 are Q0n32 (value / 2^32) to keep them accurate 
+  to well under a cent
+
+  FMRATIO_EXPONENTIAL_DATA  - Q8n24 FM_MODE_EXPONENTIAL multiples for MOD_RATIO / 61 = 1-16 (cell 0 isn't used)
+                              0, 1/32, 1/16, 1/8, 1/4, 1/2, 1, 1.5, 2, 2.5, 3, 3.5, 4, 5, 6, 7, 8
+  FMRATIO_SUBHARMONIC_DATA  - Q0n32 FM_MODE_EXPONENTIAL 1 / (513 - MOD_RATIO) for MOD_RATIO = 0-60
+*/
+#ifndef FMRATIO_UINT32_H_
+#define FMRATIO_UINT32_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define FMRATIO_EXPONENTIAL_NUM_CELLS 17
+#define FMRATIO_SUBHARMONIC_NUM_CELLS 61
+
+// 1/100 and 1/10000 for the linear FM modes.  LINEAR_HIGH has 4 extra fractional bits so multiplying by MOD_RATIO
+// stays accurate:  the Q8n24 ratio is (MOD_RATIO * FMRATIO_LINEAR_HIGH + 8) >> 4.  the Q0n32 ratio for LINEAR_LOW 
+// is MOD_RATIO * FMRATIO_LINEAR_LOW
+#define FMRATIO_LINEAR_HIGH           2684355UL   // 2^28 / 100
+#define FMRATIO_LINEAR_LOW            429497UL    // 2^32 / 10000
+
+/** @ingroup tables
+FM_MODE_EXPONENTIAL modulator ratios
+*/
+
+CONSTTABLE_STORAGE(uint32_t) FMRATIO_EXPONENTIAL_DATA [17]  =
+        {
+            0,524288,1048576,2097152,4194304,8388608
+            ,16777216,25165824,33554432,41943040,50331648,58720256
+            ,67108864,83886080,100663296,117440512,134217728
+        };
+
+CONSTTABLE_STORAGE(uint32_t) FMRATIO_SUBHARMONIC_DATA [61]  =
+        {
+            8372256,8388608,8405024,8421505,8438050,8454660,8471336,8488078
+            ,8504886,8521761,8538702,8555712,8572789,8589935,8607149,8624432
+            ,8641785,8659208,8676702,8694266,8711901,8729608,8747388,8765239
+            ,8783164,8801162,8819235,8837381,8855603,8873899,8892272,8910721
+            ,8929246,8947849,8966529,8985287,9004124,9023041,9042036,9061112
+            ,9080269,9099507,9118827,9138228,9157713,9177281,9196932,9216668
+            ,9236489,9256395,9276387,9296466,9316632,9336885,9357227,9377658
+            ,9398178,9418788,9439489,9460280,9481164
+        };
+
+
+#endif /* FMRATIO_UINT32_H_ */
@@ -0,0 +1,45 @@
+/*
+  formant256_int8.h - vowel-like peak at the 4th harmonic
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 0.3 0.2 0.4 1 0.6 0.3 0.2
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef FORMANT256_H_
+#define FORMANT256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define FORMANT256_NUM_CELLS 256
+#define FORMANT256_SAMPLERATE 256
+
+/** @ingroup tables
+formant256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) FORMANT256_DATA [256]  =
+        {
+            0,15,29,44,57,70,82,92,102,110,116,121,125,127,127,126
+            ,123,119,114,108,100,92,83,74,64,54,44,35,25,16,7,-1
+            ,-9,-15,-21,-26,-30,-34,-36,-38,-39,-40,-39,-39,-37,-35,-33,-31
+            ,-28,-26,-23,-20,-17,-14,-11,-8,-5,-2,1,3,6,8,10,13
+            ,15,17,19,21,23,25,27,29,30,32,33,34,35,36,36,36
+            ,36,36,35,34,33,31,29,27,24,22,19,16,13,10,7,4
+            ,1,-1,-4,-6,-8,-10,-11,-12,-13,-14,-14,-14,-14,-14,-13,-13
+            ,-12,-11,-10,-9,-8,-7,-6,-5,-4,-3,-3,-2,-2,-1,-1,0
+            ,0,0,1,1,2,2,3,3,4,5,6,7,8,9,10,11
+            ,12,13,13,14,14,14,14,14,13,12,11,10,8,6,4,1
+            ,-1,-4,-7,-10,-13,-16,-19,-22,-24,-27,-29,-31,-33,-34,-35,-36
+            ,-36,-36,-36,-36,-35,-34,-33,-32,-30,-29,-27,-25,-23,-21,-19,-17
+            ,-15,-13,-10,-8,-6,-3,-1,2,5,8,11,14,17,20,23,26
+            ,28,31,33,35,37,39,39,40,39,38,36,34,30,26,21,15
+            ,9,1,-7,-16,-25,-35,-44,-54,-64,-74,-83,-92,-100,-108,-114,-119
+            ,-123,-126,-127,-127,-125,-121,-116,-110,-102,-92,-82,-70,-57,-44,-29,-15
+        };
+
+
+#endif /* FORMANT256_H_ */
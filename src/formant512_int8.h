@@ -0,0 +1,61 @@
+/*
+  formant512_int8.h - vowel-like peak at the 4th harmonic
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 0.3 0.2 0.4 1 0.6 0.3 0.2
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef FORMANT512_H_
+#define FORMANT512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define FORMANT512_NUM_CELLS 512
+#define FORMANT512_SAMPLERATE 512
+
+/** @ingroup tables
+formant512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) FORMANT512_DATA [512]  =
+        {
+            0,7,15,22,29,37,44,50,57,64,70,76,82,87,92,97
+            ,102,106,110,113,116,119,121,123,125,126,127,127,127,127,126,125
+            ,123,121,119,117,114,111,108,104,100,96,92,88,83,79,74,69
+            ,64,59,54,49,44,39,35,30,25,20,16,11,7,3,-1,-5
+            ,-9,-12,-15,-18,-21,-24,-26,-28,-30,-32,-34,-35,-36,-37,-38,-39
+            ,-39,-40,-40,-40,-39,-39,-39,-38,-37,-36,-35,-34,-33,-32,-31,-30
+            ,-28,-27,-26,-24,-23,-21,-20,-18,-17,-15,-14,-12,-11,-9,-8,-6
+            ,-5,-3,-2,-1,1,2,3,4,6,7,8,9,10,12,13,14
+            ,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30
+            ,30,31,32,33,33,34,34,35,35,36,36,36,36,36,36,36
+            ,36,36,36,35,35,34,34,33,33,32,31,30,29,28,27,26
+            ,24,23,22,20,19,18,16,15,13,12,10,9,7,6,4,3
+            ,1,0,-1,-2,-4,-5,-6,-7,-8,-9,-10,-11,-11,-12,-12,-13
+            ,-13,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-14,-13,-13,-13,-12
+            ,-12,-11,-11,-10,-10,-9,-9,-8,-8,-7,-7,-6,-6,-6,-5,-5
+            ,-4,-4,-3,-3,-3,-2,-2,-2,-2,-1,-1,-1,-1,-1,0,0
+            ,0,0,0,1,1,1,1,1,2,2,2,2,3,3,3,4
+            ,4,5,5,6,6,6,7,7,8,8,9,9,10,10,11,11
+            ,12,12,13,13,13,14,14,14,14,14,14,14,14,14,14,14
+            ,13,13,12,12,11,11,10,9,8,7,6,5,4,2,1,0
+            ,-1,-3,-4,-6,-7,-9,-10,-12,-13,-15,-16,-18,-19,-20,-22,-23
+            ,-24,-26,-27,-28,-29,-30,-31,-32,-33,-33,-34,-34,-35,-35,-36,-36
+            ,-36,-36,-36,-36,-36,-36,-36,-36,-35,-35,-34,-34,-33,-33,-32,-31
+            ,-30,-30,-29,-28,-27,-26,-25,-24,-23,-22,-21,-20,-19,-18,-17,-16
+            ,-15,-14,-13,-12,-10,-9,-8,-7,-6,-4,-3,-2,-1,1,2,3
+            ,5,6,8,9,11,12,14,15,17,18,20,21,23,24,26,27
+            ,28,30,31,32,33,34,35,36,37,38,39,39,39,40,40,40
+            ,39,39,38,37,36,35,34,32,30,28,26,24,21,18,15,12
+            ,9,5,1,-3,-7,-11,-16,-20,-25,-30,-35,-39,-44,-49,-54,-59
+            ,-64,-69,-74,-79,-83,-88,-92,-96,-100,-104,-108,-111,-114,-117,-119,-121
+            ,-123,-125,-126,-127,-127,-127,-127,-126,-125,-123,-121,-119,-116,-113,-110,-106
+            ,-102,-97,-92,-87,-82,-76,-70,-64,-57,-50,-44,-37,-29,-22,-15,-7
+        };
+
+
+#endif /* FORMANT512_H_ */
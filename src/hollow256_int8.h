@@ -0,0 +1,45 @@
+/*
+  hollow256_int8.h - odd harmonics to the 5th, a soft square
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0 0.33 0 0.2
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef HOLLOW256_H_
+#define HOLLOW256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define HOLLOW256_NUM_CELLS 256
+#define HOLLOW256_SAMPLERATE 256
+
+/** @ingroup tables
+hollow256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) HOLLOW256_DATA [256]  =
+        {
+            0,10,20,30,39,49,58,66,74,82,89,96,102,107,112,116
+            ,119,122,124,126,127,127,127,126,125,124,122,121,118,116,114,112
+            ,109,107,105,103,101,99,98,96,96,95,95,95,95,95,96,97
+            ,98,100,101,103,105,107,108,110,112,113,115,116,117,118,118,119
+            ,119,119,118,118,117,116,115,113,112,110,108,107,105,103,101,100
+            ,98,97,96,95,95,95,95,95,96,96,98,99,101,103,105,107
+            ,109,112,114,116,118,121,122,124,125,126,127,127,127,126,124,122
+            ,119,116,112,107,102,96,89,82,74,66,58,49,39,30,20,10
+            ,0,-10,-20,-30,-39,-49,-58,-66,-74,-82,-89,-96,-102,-107,-112,-116
+            ,-119,-122,-124,-126,-127,-127,-127,-126,-125,-124,-122,-121,-118,-116,-114,-112
+            ,-109,-107,-105,-103,-101,-99,-98,-96,-96,-95,-95,-95,-95,-95,-96,-97
+            ,-98,-100,-101,-103,-105,-107,-108,-110,-112,-113,-115,-116,-117,-118,-118,-119
+            ,-119,-119,-118,-118,-117,-116,-115,-113,-112,-110,-108,-107,-105,-103,-101,-100
+            ,-98,-97,-96,-95,-95,-95,-95,-95,-96,-96,-98,-99,-101,-103,-105,-107
+            ,-109,-112,-114,-116,-118,-121,-122,-124,-125,-126,-127,-127,-127,-126,-124,-122
+            ,-119,-116,-112,-107,-102,-96,-89,-82,-74,-66,-58,-49,-39,-30,-20,-10
+        };
+
+
+#endif /* HOLLOW256_H_ */
@@ -0,0 +1,61 @@
+/*
+  hollow512_int8.h - odd harmonics to the 5th, a soft square
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0 0.33 0 0.2
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef HOLLOW512_H_
+#define HOLLOW512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define HOLLOW512_NUM_CELLS 512
+#define HOLLOW512_SAMPLERATE 512
+
+/** @ingroup tables
+hollow512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) HOLLOW512_DATA [512]  =
+        {
+            0,5,10,15,20,25,30,35,39,44,49,53,58,62,66,70
+            ,74,78,82,86,89,93,96,99,102,104,107,109,112,114,116,118
+            ,119,121,122,123,124,125,126,126,127,127,127,127,127,127,126,126
+            ,125,125,124,123,122,122,121,120,118,117,116,115,114,113,111,110
+            ,109,108,107,106,105,104,103,102,101,100,99,98,98,97,96,96
+            ,96,95,95,95,95,95,95,95,95,95,95,96,96,97,97,98
+            ,98,99,100,101,101,102,103,104,105,106,107,107,108,109,110,111
+            ,112,112,113,114,115,115,116,116,117,117,118,118,118,119,119,119
+            ,119,119,119,119,118,118,118,117,117,116,116,115,115,114,113,112
+            ,112,111,110,109,108,107,107,106,105,104,103,102,101,101,100,99
+            ,98,98,97,97,96,96,95,95,95,95,95,95,95,95,95,95
+            ,96,96,96,97,98,98,99,100,101,102,103,104,105,106,107,108
+            ,109,110,111,113,114,115,116,117,118,120,121,122,122,123,124,125
+            ,125,126,126,127,127,127,127,127,127,126,126,125,124,123,122,121
+            ,119,118,116,114,112,109,107,104,102,99,96,93,89,86,82,78
+            ,74,70,66,62,58,53,49,44,39,35,30,25,20,15,10,5
+            ,0,-5,-10,-15,-20,-25,-30,-35,-39,-44,-49,-53,-58,-62,-66,-70
+            ,-74,-78,-82,-86,-89,-93,-96,-99,-102,-104,-107,-109,-112,-114,-116,-118
+            ,-119,-121,-122,-123,-124,-125,-126,-126,-127,-127,-127,-127,-127,-127,-126,-126
+            ,-125,-125,-124,-123,-122,-122,-121,-120,-118,-117,-116,-115,-114,-113,-111,-110
+            ,-109,-108,-107,-106,-105,-104,-103,-102,-101,-100,-99,-98,-98,-97,-96,-96
+            ,-96,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95,-96,-96,-97,-97,-98
+            ,-98,-99,-100,-101,-101,-102,-103,-104,-105,-106,-107,-107,-108,-109,-110,-111
+            ,-112,-112,-113,-114,-115,-115,-116,-116,-117,-117,-118,-118,-118,-119,-119,-119
+            ,-119,-119,-119,-119,-118,-118,-118,-117,-117,-116,-116,-115,-115,-114,-113,-112
+            ,-112,-111,-110,-109,-108,-107,-107,-106,-105,-104,-103,-102,-101,-101,-100,-99
+            ,-98,-98,-97,-97,-96,-96,-95,-95,-95,-95,-95,-95,-95,-95,-95,-95
+            ,-96,-96,-96,-97,-98,-98,-99,-100,-101,-102,-103,-104,-105,-106,-107,-108
+            ,-109,-110,-111,-113,-114,-115,-116,-117,-118,-120,-121,-122,-122,-123,-124,-125
+            ,-125,-126,-126,-127,-127,-127,-127,-127,-127,-126,-126,-125,-124,-123,-122,-121
+            ,-119,-118,-116,-114,-112,-109,-107,-104,-102,-99,-96,-93,-89,-86,-82,-78
+            ,-74,-70,-66,-62,-58,-53,-49,-44,-39,-35,-30,-25,-20,-15,-10,-5
+        };
+
+
+#endif /* HOLLOW512_H_ */
@@ -0,0 +1,45 @@
+/*
+  metallic256_int8.h - sine with the 8th & 14th harmonics
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0 0 0 0 0 0 0.6 0 0 0 0 0 0.4
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef METALLIC256_H_
+#define METALLIC256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define METALLIC256_NUM_CELLS 256
+#define METALLIC256_SAMPLERATE 256
+
+/** @ingroup tables
+metallic256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) METALLIC256_DATA [256]  =
+        {
+            0,19,37,52,63,70,73,71,66,57,47,37,26,18,12,8
+            ,7,8,11,15,19,22,24,24,23,20,16,12,9,8,9,14
+            ,21,32,46,61,78,93,107,118,125,127,124,117,106,92,76,60
+            ,44,31,22,16,14,16,21,28,37,46,55,62,67,70,71,70
+            ,69,68,68,68,71,76,83,90,99,107,114,118,119,116,109,98
+            ,84,67,49,32,16,3,-6,-10,-10,-5,4,16,30,44,57,68
+            ,77,82,84,83,79,73,67,60,54,50,48,46,47,48,48,48
+            ,46,42,35,26,14,0,-14,-27,-39,-48,-53,-54,-50,-42,-30,-16
+            ,0,16,30,42,50,54,53,48,39,27,14,0,-14,-26,-35,-42
+            ,-46,-48,-48,-48,-47,-46,-48,-50,-54,-60,-67,-73,-79,-83,-84,-82
+            ,-77,-68,-57,-44,-30,-16,-4,5,10,10,6,-3,-16,-32,-49,-67
+            ,-84,-98,-109,-116,-119,-118,-114,-107,-99,-90,-83,-76,-71,-68,-68,-68
+            ,-69,-70,-71,-70,-67,-62,-55,-46,-37,-28,-21,-16,-14,-16,-22,-31
+            ,-44,-60,-76,-92,-106,-117,-124,-127,-125,-118,-107,-93,-78,-61,-46,-32
+            ,-21,-14,-9,-8,-9,-12,-16,-20,-23,-24,-24,-22,-19,-15,-11,-8
+            ,-7,-8,-12,-18,-26,-37,-47,-57,-66,-71,-73,-70,-63,-52,-37,-19
+        };
+
+
+#endif /* METALLIC256_H_ */
@@ -0,0 +1,61 @@
+/*
+  metallic512_int8.h - sine with the 8th & 14th harmonics
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0 0 0 0 0 0 0.6 0 0 0 0 0 0.4
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef METALLIC512_H_
+#define METALLIC512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define METALLIC512_NUM_CELLS 512
+#define METALLIC512_SAMPLERATE 512
+
+/** @ingroup tables
+metallic512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) METALLIC512_DATA [512]  =
+        {
+            0,10,19,28,37,45,52,58,63,67,70,72,73,73,71,69
+            ,66,62,57,52,47,42,37,31,26,22,18,14,12,9,8,7
+            ,7,7,8,9,11,13,15,17,19,20,22,23,24,24,24,23
+            ,23,21,20,18,16,14,12,10,9,8,8,8,9,11,14,17
+            ,21,26,32,39,46,53,61,69,78,86,93,101,107,113,118,122
+            ,125,126,127,126,124,121,117,112,106,99,92,84,76,68,60,52
+            ,44,38,31,26,22,18,16,14,14,14,16,18,21,24,28,32
+            ,37,42,46,50,55,58,62,64,67,69,70,71,71,71,70,70
+            ,69,69,68,68,68,68,68,70,71,73,76,79,83,86,90,95
+            ,99,103,107,111,114,116,118,119,119,118,116,113,109,104,98,91
+            ,84,76,67,58,49,41,32,24,16,9,3,-2,-6,-8,-10,-10
+            ,-10,-8,-5,-1,4,10,16,23,30,37,44,50,57,63,68,73
+            ,77,80,82,83,84,84,83,81,79,76,73,70,67,63,60,57
+            ,54,52,50,49,48,47,46,46,47,47,48,48,48,48,48,47
+            ,46,44,42,39,35,31,26,20,14,7,0,-7,-14,-20,-27,-33
+            ,-39,-44,-48,-51,-53,-54,-54,-52,-50,-46,-42,-36,-30,-23,-16,-8
+            ,0,8,16,23,30,36,42,46,50,52,54,54,53,51,48,44
+            ,39,33,27,20,14,7,0,-7,-14,-20,-26,-31,-35,-39,-42,-44
+            ,-46,-47,-48,-48,-48,-48,-48,-47,-47,-46,-46,-47,-48,-49,-50,-52
+            ,-54,-57,-60,-63,-67,-70,-73,-76,-79,-81,-83,-84,-84,-83,-82,-80
+            ,-77,-73,-68,-63,-57,-50,-44,-37,-30,-23,-16,-10,-4,1,5,8
+            ,10,10,10,8,6,2,-3,-9,-16,-24,-32,-41,-49,-58,-67,-76
+            ,-84,-91,-98,-104,-109,-113,-116,-118,-119,-119,-118,-116,-114,-111,-107,-103
+            ,-99,-95,-90,-86,-83,-79,-76,-73,-71,-70,-68,-68,-68,-68,-68,-69
+            ,-69,-70,-70,-71,-71,-71,-70,-69,-67,-64,-62,-58,-55,-50,-46,-42
+            ,-37,-32,-28,-24,-21,-18,-16,-14,-14,-14,-16,-18,-22,-26,-31,-38
+            ,-44,-52,-60,-68,-76,-84,-92,-99,-106,-112,-117,-121,-124,-126,-127,-126
+            ,-125,-122,-118,-113,-107,-101,-93,-86,-78,-69,-61,-53,-46,-39,-32,-26
+            ,-21,-17,-14,-11,-9,-8,-8,-8,-9,-10,-12,-14,-16,-18,-20,-21
+            ,-23,-23,-24,-24,-24,-23,-22,-20,-19,-17,-15,-13,-11,-9,-8,-7
+            ,-7,-7,-8,-9,-12,-14,-18,-22,-26,-31,-37,-42,-47,-52,-57,-62
+            ,-66,-69,-71,-73,-73,-72,-70,-67,-63,-58,-52,-45,-37,-28,-19,-10
+        };
+
+
+#endif /* METALLIC512_H_ */
@@ -0,0 +1,51 @@
+/*
+  midinotephaseinc_uint32.h - defines the carrier oscillator phase increment for each MIDI note, used by MutatingFM::setFreqs()
+
+  each cell is round(2^16 * 2048 * 440 * 2^((note - 69) / 12) / 16384), the Oscil phase increment (16 fractional bits)
+  that plays the note's equal tempered frequency from a 2048 cell table at an AUDIO_RATE of 16384.  notes at or 
+  above the Nyquist frequency (8192Hz, an increment of 2^26), 120-127, are folded down by octaves until they're under 
+  it, as host/sclToHeader.cpp does for other tunings.
+  replaces Q16n16_mtof() and Oscil::setFreq_Q16n16() on each note with a single table read
+  
+  must be regenerated if the table size or AUDIO_RATE change
+*/
+#ifndef MIDINOTEPHASEINC_UINT32_H_
+#define MIDINOTEPHASEINC_UINT32_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define MIDINOTE_PHASEINC_NUM_CELLS   128
+#define MIDINOTE_PHASEINC_TABLE_CELLS 2048
+#define MIDINOTE_PHASEINC_AUDIO_RATE  16384
+
+/** @ingroup tables
+carrier phase increment per MIDI note
+*/
+
+CONSTTABLE_STORAGE(uint32_t) MIDINOTE_PHASEINC_DATA [128]  =
+        {
+            66976,70959,75178,79649,84385,89402,94719,100351
+            ,106318,112640,119338,126434,133952,141918,150356,159297
+            ,168769,178805,189437,200702,212636,225280,238676,252868
+            ,267905,283835,300713,318594,337539,357610,378874,401403
+            ,425272,450560,477352,505737,535809,567670,601425,637188
+            ,675077,715219,757749,802807,850544,901120,954703,1011473
+            ,1071618,1135340,1202851,1274376,1350154,1430439,1515497,1605613
+            ,1701088,1802240,1909407,2022946,2143237,2270680,2405702,2548752
+            ,2700309,2860878,3030994,3211227,3402176,3604480,3818814,4045892
+            ,4286473,4541360,4811404,5097505,5400618,5721755,6061989,6422453
+            ,6804352,7208960,7637627,8091784,8572947,9082720,9622807,10195009
+            ,10801236,11443511,12123977,12844906,13608704,14417920,15275254,16183568
+            ,17145893,18165441,19245614,20390018,21602472,22887021,24247954,25689813
+            ,27217409,28835840,30550508,32367136,34291786,36330882,38491228,40780036
+            ,43204943,45774043,48495909,51379626,54434817,57671680,61101017,64734272
+            ,34291786,36330882,38491228,40780036,43204943,45774043,48495909,51379626
+        };
+
+
+#endif /* MIDINOTEPHASEINC_UINT32_H_ */
@@ -52,19 +52,25 @@ const PROGMEM byte BITMAP_ALPHA[7][8]  = {
                                     ,{B00000000,B00000000,B00000000,B11100000,B10000000,B10100000,B10100000,B11100000}
                                       };
 
-/** @brief if COMPILE_SMALLER_BINARY flag is defined, omit the definition of the pseudorandom waveform icon */
-#ifdef COMPILE_SMALLER_BINARY
-const PROGMEM byte BITMAP_WAVEFORMS[5][8]  = {
-#else
-const PROGMEM byte BITMAP_WAVEFORMS[6][8]  = {
-#endif
+// one icon per WAVEFORM_* (avSource.h), in the same order
+const PROGMEM byte BITMAP_WAVEFORMS[MAX_WAVEFORMS][8]  = {
                                     {B00000000,B01100000,B10010000,B10010000,B00001001,B00001001,B00000110,B00000000}
                                     , {B00000000,B10000011,B10000101,B10001001,B10010001,B10100001,B11000001,B00000000}
                                     , {B00000000,B11000001,B10100001,B10010001,B10001001,B10000101,B10000011,B00000000}
                                     , {B00000000,B11110000,B10010000,B10010000,B10010001,B00010001,B00011111,B00000000}
-#ifndef COMPILE_SMALLER_BINARY
+                                    #ifdef INTERPOLATED_WAVETABLE_CELLS
+                                    , {B00000000,B00011000,B00100100,B00100100,B01000010,B01000010,B10000001,B00000000}
+                                    , {B00000000,B11000000,B01000000,B01000000,B01000000,B01000000,B01111111,B00000000}
+                                    , {B00000000,B10000000,B10000000,B10000000,B10000000,B10000000,B11111111,B00000000}
+                                    , {B00000000,B11100000,B10100000,B10111000,B00001101,B00000101,B00000111,B00000000}
+                                    , {B00000000,B11110000,B11110000,B10011000,B00001001,B00001111,B00001111,B00000000}
+                                    , {B00000000,B11100000,B10100000,B10111000,B00011101,B00000101,B00000111,B00000000}
+                                    , {B00000000,B11110000,B10010000,B10011000,B00001001,B00001001,B00001111,B00000000}
+                                    , {B00000000,B10000000,B10000000,B11111011,B11011111,B00000001,B00000001,B00000000}
+                                    , {B00000000,B01100000,B11111000,B11111100,B00111111,B00011111,B00000110,B00000000}
+                                    , {B00000000,B11000000,B11100000,B10111000,B00001101,B00000111,B00000011,B00000000}
+                                    #endif
                                     , {B00000000,B10010001,B00001000,B00100010,B10000100,B00010001,B01000100,B00000000}
-#endif
                                     , {B00000000,B00000000,B00000000,B11111111,B00000000,B00000000,B00000000,B00000000}
                                     };
 
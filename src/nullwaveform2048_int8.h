@@ -1,9 +1,8 @@
 /*
-  NULLWAVEFORM2018_int8.h - defines a table representing a zero waveform
+  nullwaveform2048_int8.h - defines a table representing a zero waveform - used to turn the carrier off
 
-  used to silence the oscillator 
-    
-  can be replaced with any values you like, but must be 2048 cells to match the other tables
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  formula zero
+  edit the spec & regenerate rather than editing this file
 */
 #ifndef NULLWAVEFORM2048_H_
 #define NULLWAVEFORM2048_H_
@@ -19,12 +18,12 @@
 #define NULLWAVEFORM2048_SAMPLERATE 2048
 
 /** @ingroup tables
-reverse saw table
+nullwaveform2048 table
 */
 
 CONSTTABLE_STORAGE(int8_t) NULLWAVEFORM2048_DATA [2048]  =
         {
-             0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
             ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
             ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
             ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
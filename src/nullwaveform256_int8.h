@@ -0,0 +1,45 @@
+/*
+  nullwaveform256_int8.h - zero waveform for INTERPOLATED_WAVETABLE_CELLS 256
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  formula zero
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef NULLWAVEFORM256_H_
+#define NULLWAVEFORM256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define NULLWAVEFORM256_NUM_CELLS 256
+#define NULLWAVEFORM256_SAMPLERATE 256
+
+/** @ingroup tables
+nullwaveform256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) NULLWAVEFORM256_DATA [256]  =
+        {
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+        };
+
+
+#endif /* NULLWAVEFORM256_H_ */
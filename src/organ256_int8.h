@@ -0,0 +1,45 @@
+/*
+  organ256_int8.h - sine with 3 octaves, like drawbars
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0.5 0 0.25 0 0 0 0.125
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef ORGAN256_H_
+#define ORGAN256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define ORGAN256_NUM_CELLS 256
+#define ORGAN256_SAMPLERATE 256
+
+/** @ingroup tables
+organ256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) ORGAN256_DATA [256]  =
+        {
+            0,10,20,29,38,47,55,63,69,76,81,86,89,93,96,98
+            ,99,101,102,103,104,105,106,107,108,109,111,112,114,116,118,120
+            ,122,123,125,126,127,127,127,126,125,124,122,119,116,113,110,107
+            ,104,100,97,95,92,90,89,88,88,88,89,90,92,94,96,98
+            ,101,103,106,107,109,110,111,111,110,109,107,104,101,97,93,88
+            ,83,77,72,67,61,56,51,47,42,39,35,32,29,27,25,23
+            ,21,19,17,16,14,12,9,7,4,1,-2,-5,-9,-12,-16,-19
+            ,-22,-25,-28,-30,-31,-32,-32,-31,-30,-28,-25,-22,-19,-14,-10,-5
+            ,0,5,10,14,19,22,25,28,30,31,32,32,31,30,28,25
+            ,22,19,16,12,9,5,2,-1,-4,-7,-9,-12,-14,-16,-17,-19
+            ,-21,-23,-25,-27,-29,-32,-35,-39,-42,-47,-51,-56,-61,-67,-72,-77
+            ,-83,-88,-93,-97,-101,-104,-107,-109,-110,-111,-111,-110,-109,-107,-106,-103
+            ,-101,-98,-96,-94,-92,-90,-89,-88,-88,-88,-89,-90,-92,-95,-97,-100
+            ,-104,-107,-110,-113,-116,-119,-122,-124,-125,-126,-127,-127,-127,-126,-125,-123
+            ,-122,-120,-118,-116,-114,-112,-111,-109,-108,-107,-106,-105,-104,-103,-102,-101
+            ,-99,-98,-96,-93,-89,-86,-81,-76,-69,-63,-55,-47,-38,-29,-20,-10
+        };
+
+
+#endif /* ORGAN256_H_ */
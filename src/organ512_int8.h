@@ -0,0 +1,61 @@
+/*
+  organ512_int8.h - sine with 3 octaves, like drawbars
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0.5 0 0.25 0 0 0 0.125
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef ORGAN512_H_
+#define ORGAN512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define ORGAN512_NUM_CELLS 512
+#define ORGAN512_SAMPLERATE 512
+
+/** @ingroup tables
+organ512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) ORGAN512_DATA [512]  =
+        {
+            0,5,10,15,20,24,29,34,38,43,47,51,55,59,63,66
+            ,69,73,76,78,81,83,86,88,89,91,93,94,96,97,98,99
+            ,99,100,101,101,102,102,103,103,104,104,105,105,106,106,107,107
+            ,108,108,109,110,111,111,112,113,114,115,116,117,118,119,120,121
+            ,122,123,123,124,125,125,126,126,127,127,127,127,127,127,126,126
+            ,125,124,124,123,122,120,119,118,116,115,113,112,110,109,107,105
+            ,104,102,100,99,97,96,95,93,92,91,90,90,89,88,88,88
+            ,88,88,88,88,89,89,90,91,92,93,94,95,96,97,98,100
+            ,101,102,103,104,106,107,107,108,109,110,110,111,111,111,111,110
+            ,110,109,109,108,107,105,104,102,101,99,97,95,93,90,88,85
+            ,83,80,77,75,72,69,67,64,61,59,56,54,51,49,47,45
+            ,42,40,39,37,35,34,32,31,29,28,27,26,25,24,23,22
+            ,21,20,19,18,17,17,16,15,14,13,12,11,9,8,7,6
+            ,4,3,1,0,-2,-4,-5,-7,-9,-11,-12,-14,-16,-17,-19,-21
+            ,-22,-24,-25,-26,-28,-29,-30,-30,-31,-31,-32,-32,-32,-32,-31,-31
+            ,-30,-29,-28,-27,-25,-24,-22,-20,-19,-16,-14,-12,-10,-7,-5,-2
+            ,0,2,5,7,10,12,14,16,19,20,22,24,25,27,28,29
+            ,30,31,31,32,32,32,32,31,31,30,30,29,28,26,25,24
+            ,22,21,19,17,16,14,12,11,9,7,5,4,2,0,-1,-3
+            ,-4,-6,-7,-8,-9,-11,-12,-13,-14,-15,-16,-17,-17,-18,-19,-20
+            ,-21,-22,-23,-24,-25,-26,-27,-28,-29,-31,-32,-34,-35,-37,-39,-40
+            ,-42,-45,-47,-49,-51,-54,-56,-59,-61,-64,-67,-69,-72,-75,-77,-80
+            ,-83,-85,-88,-90,-93,-95,-97,-99,-101,-102,-104,-105,-107,-108,-109,-109
+            ,-110,-110,-111,-111,-111,-111,-110,-110,-109,-108,-107,-107,-106,-104,-103,-102
+            ,-101,-100,-98,-97,-96,-95,-94,-93,-92,-91,-90,-89,-89,-88,-88,-88
+            ,-88,-88,-88,-88,-89,-90,-90,-91,-92,-93,-95,-96,-97,-99,-100,-102
+            ,-104,-105,-107,-109,-110,-112,-113,-115,-116,-118,-119,-120,-122,-123,-124,-124
+            ,-125,-126,-126,-127,-127,-127,-127,-127,-127,-126,-126,-125,-125,-124,-123,-123
+            ,-122,-121,-120,-119,-118,-117,-116,-115,-114,-113,-112,-111,-111,-110,-109,-108
+            ,-108,-107,-107,-106,-106,-105,-105,-104,-104,-103,-103,-102,-102,-101,-101,-100
+            ,-99,-99,-98,-97,-96,-94,-93,-91,-89,-88,-86,-83,-81,-78,-76,-73
+            ,-69,-66,-63,-59,-55,-51,-47,-43,-38,-34,-29,-24,-20,-15,-10,-5
+        };
+
+
+#endif /* ORGAN512_H_ */
@@ -1,296 +0,0 @@
-/*
-  pseudorandom2048_int8.h - defines a table to semi-random values with a slight smoothing between them
-
-  used for the LFO/carrier/modulator 
-
-  can be replaced with any values you like, but must be 2048 cells to match the other tables
-*/
-
-#ifndef PSEUDORANDOM2048_H_
-#define PSEUDORANDOM2048_H_
-
-#if ARDUINO >= 100
- #include "Arduino.h"
-#else
- #include "WProgram.h"
-#endif
-#include "mozzi_pgmspace.h"
-
-#define PSEUDORANDOM2048_NUM_CELLS 2048
-#define PSEUDORANDOM2048_SAMPLERATE 2048
-
-/** @ingroup tables
-random table. smoothed
-*/
-CONSTTABLE_STORAGE(int8_t) PSEUDORANDOM2048_DATA [2048]  =
-        {
-            41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-            ,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-            ,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-            ,35,29,24,18,12,6,0,-6,-11,-17,-23,-29,-35,-40,-46,-52
-            ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-            ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-            ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-            ,-52,-51,-51,-51,-50,-50,-50,-50,-49,-49,-49,-48,-48,-48,-47,-47
-            ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-            ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-            ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-            ,-47,-48,-48,-49,-49,-50,-50,-51,-51,-51,-52,-52,-53,-53,-54,-54
-            ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-            ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-            ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-            ,-55,-56,-56,-57,-58,-59,-59,-60,-61,-62,-62,-63,-64,-65,-65,-66
-            ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-            ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-            ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-            ,-61,-57,-52,-47,-42,-38,-33,-28,-23,-19,-14,-9,-4,1,5,10
-            ,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10
-            ,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10
-            ,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10
-            ,10,9,9,9,8,8,8,8,7,7,7,6,6,6,5,5
-            ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-            ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-            ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-            ,11,17,23,29,35,41,47,54,60,66,72,78,84,90,96,102
-            ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-            ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-            ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-            ,95,89,82,76,69,63,56,50,43,36,30,23,17,10,4,-3
-            ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-            ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-            ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-            ,-2,-1,0,1,1,2,3,4,5,6,7,8,8,9,10,11
-            ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-            ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-            ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-            ,14,17,19,22,25,28,31,34,36,39,42,45,48,50,53,56
-            ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-            ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-            ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-            ,60,64,67,71,75,79,83,87,90,94,98,102,106,109,113,117
-            ,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117
-            ,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117
-            ,112,107,102,97,92,87,82,77,71,66,61,56,51,46,41,36
-            ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-            ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-            ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-            ,28,20,12,4,-4,-12,-20,-28,-35,-43,-51,-59,-67,-75,-83,-91
-            ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-            ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-            ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-            ,-78,-65,-51,-38,-25,-12,1,15,28,41,54,67,80,94,107,120
-            ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-            ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-            ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-            ,117,114,110,107,104,101,98,95,91,88,85,82,79,75,72,69
-            ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-            ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-            ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-            ,61,53,46,38,30,22,14,7,-1,-9,-17,-25,-33,-40,-48,-56
-            ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-            ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-            ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-            ,-45,-33,-22,-11,1,12,24,35,46,58,69,81,92,103,115,126
-            ,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126
-            ,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126
-            ,123,120,116,113,110,107,104,101,97,94,91,88,85,81,78,75
-            ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-            ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-            ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-            ,66,57,48,39,30,21,12,3,-7,-16,-25,-34,-43,-52,-61,-70
-            ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-            ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-            ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-            ,-61,-51,-42,-32,-23,-13,-4,6,15,24,34,43,53,62,72,81
-            ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-            ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-            ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-            ,68,56,43,31,18,5,-7,-20,-33,-45,-58,-71,-83,-96,-108,-121
-            ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-            ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-            ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-            ,-115,-108,-102,-96,-89,-83,-76,-70,-64,-57,-51,-45,-38,-32,-25,-19
-            ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-            ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-            ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-            ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-            ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-            ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-            ,-15,-12,-8,-4,-1,3,7,11,14,18,22,25,29,33,36,40
-            ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-            ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-            ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-            ,38,35,33,30,28,25,23,20,18,15,13,10,8,5,3,0
-            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-            ,7,15,22,30,37,44,52,59,66,74,81,89,96,103,111,118
-            ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-            ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-            ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-            ,114,110,107,103,99,95,91,88,84,80,76,72,68,65,61,57
-            ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-            ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-            ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-            ,60,63,66,69,72,75,78,81,84,87,90,93,96,99,102,105
-            ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-            ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-            ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-            ,101,97,94,90,86,82,78,75,71,67,63,59,55,52,48,44
-            ,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44
-            ,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44
-            ,40,36,32,28,24,20,16,12,7,3,-1,-5,-9,-13,-17,-21
-            ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-            ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-            ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-            ,-18,-16,-13,-11,-8,-5,-3,0,3,5,8,11,13,16,18,21
-            ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-            ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-            ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-            ,15,9,4,-2,-8,-14,-20,-26,-31,-37,-43,-49,-55,-60,-66,-72
-            ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-            ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-            ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-            ,-72,-65,-58,-51,-44,-37,-30,-23,-16,-9,-2,5,12,19,26,33
-
-        };
-/*
-
-// random table. not smoothed
-
-CONSTTABLE_STORAGE(int8_t) PSEUDORANDOM2048_DATA [2048]  =
-        {
-                 41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-                ,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-                ,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-                ,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41
-                ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-                ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-                ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-                ,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52,-52
-                ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-                ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-                ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-                ,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47,-47
-                ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-                ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-                ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-                ,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54,-54
-                ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-                ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-                ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-                ,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66,-66
-                ,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10
-                ,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10
-                ,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10
-                ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-                ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-                ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-                ,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
-                ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-                ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-                ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-                ,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102
-                ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-                ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-                ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-                ,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3
-                ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-                ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-                ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-                ,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
-                ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-                ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-                ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-                ,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56
-                ,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117
-                ,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117
-                ,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117
-                ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-                ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-                ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-                ,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36
-                ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-                ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-                ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-                ,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91,-91
-                ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-                ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-                ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-                ,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120,120
-                ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-                ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-                ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-                ,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69
-                ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-                ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-                ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-                ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
-                ,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126
-                ,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126
-                ,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126
-                ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-                ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-                ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-                ,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75,75
-                ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-                ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-                ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-                ,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70,-70
-                ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-                ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-                ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-                ,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81
-                ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-                ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-                ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-                ,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121,-121
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19,-19
-                ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-                ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-                ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-                ,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40,40
-                ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-                ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-                ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-                ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-                ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-                ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-                ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-                ,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118,118
-                ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-                ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-                ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-                ,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57
-                ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-                ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-                ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-                ,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105
-                ,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44
-                ,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44
-                ,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44
-                ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-                ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-                ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-                ,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21,-21
-                ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-                ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-                ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-                ,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
-                ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-                ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-                ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-                ,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72,-72
-                ,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19
-
-
-        };
-*/
-
-#endif /* PSEUDORANDOM2048_H_ */
@@ -0,0 +1,45 @@
+/*
+  pulseeighth256_int8.h - pulse, 12.5% duty
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  formula square 0.125
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef PULSEEIGHTH256_H_
+#define PULSEEIGHTH256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define PULSEEIGHTH256_NUM_CELLS 256
+#define PULSEEIGHTH256_SAMPLERATE 256
+
+/** @ingroup tables
+pulseeighth256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) PULSEEIGHTH256_DATA [256]  =
+        {
+            127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+        };
+
+
+#endif /* PULSEEIGHTH256_H_ */
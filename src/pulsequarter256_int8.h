@@ -0,0 +1,45 @@
+/*
+  pulsequarter256_int8.h - pulse, 25% duty
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  formula square 0.25
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef PULSEQUARTER256_H_
+#define PULSEQUARTER256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define PULSEQUARTER256_NUM_CELLS 256
+#define PULSEQUARTER256_SAMPLERATE 256
+
+/** @ingroup tables
+pulsequarter256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) PULSEQUARTER256_DATA [256]  =
+        {
+            127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+        };
+
+
+#endif /* PULSEQUARTER256_H_ */
@@ -0,0 +1,61 @@
+/*
+  pulsequarter512_int8.h - pulse, 25% duty
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  formula square 0.25
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef PULSEQUARTER512_H_
+#define PULSEQUARTER512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define PULSEQUARTER512_NUM_CELLS 512
+#define PULSEQUARTER512_SAMPLERATE 512
+
+/** @ingroup tables
+pulsequarter512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) PULSEQUARTER512_DATA [512]  =
+        {
+            127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
+        };
+
+
+#endif /* PULSEQUARTER512_H_ */
@@ -0,0 +1,174 @@
+/*
+  sawbandlimited256_int8.h - band-limited saw tables, one per octave
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  bandlimited saw 128 8
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SAWBANDLIMITED256_H_
+#define SAWBANDLIMITED256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SAWBANDLIMITED256_NUM_CELLS 256
+#define SAWBANDLIMITED256_SAMPLERATE 256
+#define SAWBANDLIMITED256_LEVELS 8
+
+/** @ingroup tables
+sawbandlimited256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SAWBANDLIMITED256_DATA [8][256]  =
+        {
+          {
+            0,-127,-96,-113,-100,-109,-100,-106,-99,-103,-98,-101,-96,-99,-95,-97
+            ,-94,-95,-92,-93,-90,-92,-89,-90,-87,-88,-86,-86,-84,-85,-82,-83
+            ,-81,-81,-79,-79,-77,-78,-76,-76,-74,-74,-72,-72,-71,-71,-69,-69
+            ,-67,-67,-66,-66,-64,-64,-62,-62,-61,-60,-59,-59,-57,-57,-56,-55
+            ,-54,-54,-52,-52,-51,-50,-49,-49,-47,-47,-46,-45,-44,-43,-42,-42
+            ,-40,-40,-39,-38,-37,-37,-35,-35,-34,-33,-32,-31,-30,-30,-29,-28
+            ,-27,-26,-25,-25,-24,-23,-22,-21,-20,-20,-19,-18,-17,-16,-15,-14
+            ,-14,-13,-12,-11,-10,-9,-8,-8,-7,-6,-5,-4,-3,-3,-2,-1
+            ,0,1,2,3,3,4,5,6,7,8,8,9,10,11,12,13
+            ,14,14,15,16,17,18,19,20,20,21,22,23,24,25,25,26
+            ,27,28,29,30,30,31,32,33,34,35,35,37,37,38,39,40
+            ,40,42,42,43,44,45,46,47,47,49,49,50,51,52,52,54
+            ,54,55,56,57,57,59,59,60,61,62,62,64,64,66,66,67
+            ,67,69,69,71,71,72,72,74,74,76,76,78,77,79,79,81
+            ,81,83,82,85,84,86,86,88,87,90,89,92,90,93,92,95
+            ,94,97,95,99,96,101,98,103,99,106,100,109,100,113,96,127
+          }
+          ,{
+            0,-95,-127,-109,-95,-104,-111,-103,-97,-102,-105,-99,-95,-98,-100,-96
+            ,-93,-95,-96,-93,-90,-92,-92,-89,-87,-88,-89,-86,-84,-85,-85,-82
+            ,-81,-82,-81,-79,-77,-78,-78,-75,-74,-75,-74,-72,-71,-71,-71,-69
+            ,-67,-68,-67,-65,-64,-64,-64,-62,-61,-61,-60,-58,-57,-58,-57,-55
+            ,-54,-54,-53,-51,-51,-51,-50,-48,-47,-47,-46,-45,-44,-44,-43,-41
+            ,-41,-41,-40,-38,-37,-37,-36,-34,-34,-34,-33,-31,-30,-30,-29,-28
+            ,-27,-27,-26,-24,-24,-24,-22,-21,-20,-20,-19,-17,-17,-17,-15,-14
+            ,-14,-13,-12,-11,-10,-10,-9,-7,-7,-7,-5,-4,-3,-3,-2,0
+            ,0,0,2,3,3,4,5,7,7,7,9,10,10,11,12,13
+            ,14,14,15,17,17,17,19,20,20,21,22,24,24,24,26,27
+            ,27,28,29,30,30,31,33,34,34,34,36,37,37,38,40,41
+            ,41,41,43,44,44,45,46,47,47,48,50,51,51,51,53,54
+            ,54,55,57,58,57,58,60,61,61,62,64,64,64,65,67,68
+            ,67,69,71,71,71,72,74,75,74,75,78,78,77,79,81,82
+            ,81,82,85,85,84,86,89,88,87,89,92,92,90,93,96,95
+            ,93,96,100,98,95,99,105,102,97,103,111,104,95,109,127,95
+          }
+          ,{
+            0,-53,-96,-121,-127,-120,-107,-97,-93,-96,-102,-107,-108,-104,-98,-93
+            ,-91,-93,-96,-98,-98,-95,-91,-87,-86,-87,-89,-90,-90,-87,-84,-81
+            ,-80,-81,-82,-83,-82,-80,-77,-75,-74,-75,-75,-76,-74,-72,-70,-68
+            ,-68,-68,-68,-68,-67,-65,-63,-61,-61,-61,-62,-61,-60,-58,-56,-55
+            ,-54,-54,-55,-54,-53,-51,-49,-48,-48,-48,-48,-47,-46,-44,-42,-41
+            ,-41,-41,-41,-40,-39,-37,-35,-34,-34,-34,-34,-33,-32,-30,-28,-27
+            ,-27,-27,-27,-26,-25,-23,-21,-21,-20,-20,-20,-19,-18,-16,-14,-14
+            ,-14,-14,-13,-12,-11,-9,-8,-7,-7,-7,-6,-5,-4,-2,-1,0
+            ,0,0,1,2,4,5,6,7,7,7,8,9,11,12,13,14
+            ,14,14,14,16,18,19,20,20,20,21,21,23,25,26,27,27
+            ,27,27,28,30,32,33,34,34,34,34,35,37,39,40,41,41
+            ,41,41,42,44,46,47,48,48,48,48,49,51,53,54,55,54
+            ,54,55,56,58,60,61,62,61,61,61,63,65,67,68,68,68
+            ,68,68,70,72,74,76,75,75,74,75,77,80,82,83,82,81
+            ,80,81,84,87,90,90,89,87,86,87,91,95,98,98,96,93
+            ,91,93,98,104,108,107,102,96,93,97,107,120,127,121,96,53
+          }
+          ,{
+            0,-28,-55,-78,-98,-113,-122,-127,-127,-124,-118,-111,-104,-97,-93,-90
+            ,-89,-89,-92,-94,-97,-100,-101,-101,-100,-97,-94,-91,-87,-84,-82,-80
+            ,-80,-80,-81,-83,-84,-84,-85,-84,-82,-80,-78,-75,-73,-71,-69,-68
+            ,-68,-68,-69,-69,-70,-70,-69,-68,-67,-65,-63,-60,-58,-57,-56,-55
+            ,-55,-55,-55,-55,-55,-55,-54,-53,-52,-50,-48,-46,-44,-43,-42,-41
+            ,-41,-41,-41,-41,-41,-41,-40,-38,-37,-35,-33,-31,-30,-29,-28,-28
+            ,-28,-28,-28,-27,-27,-26,-25,-24,-22,-20,-18,-17,-16,-15,-14,-14
+            ,-14,-14,-14,-13,-13,-12,-11,-9,-7,-6,-4,-2,-1,-1,0,0
+            ,0,0,0,1,1,2,4,6,7,9,11,12,13,13,14,14
+            ,14,14,14,15,16,17,18,20,22,24,25,26,27,27,28,28
+            ,28,28,28,29,30,31,33,35,37,38,40,41,41,41,41,41
+            ,41,41,42,43,44,46,48,50,52,53,54,55,55,55,55,55
+            ,55,55,56,57,58,60,63,65,67,68,69,70,70,69,69,68
+            ,68,68,69,71,73,75,78,80,82,84,85,84,84,83,81,80
+            ,80,80,82,84,87,91,94,97,100,101,101,100,97,94,92,89
+            ,89,90,93,97,104,111,118,124,127,127,122,113,98,78,55,28
+          }
+          ,{
+            0,-15,-29,-44,-57,-70,-82,-92,-101,-109,-115,-120,-124,-126,-127,-127
+            ,-125,-123,-120,-116,-112,-108,-104,-99,-95,-91,-88,-85,-82,-81,-79,-79
+            ,-78,-79,-79,-80,-81,-82,-83,-85,-85,-86,-87,-87,-86,-86,-85,-83
+            ,-81,-79,-77,-75,-72,-70,-67,-65,-63,-61,-59,-58,-57,-56,-55,-55
+            ,-55,-55,-55,-56,-56,-56,-56,-56,-56,-56,-56,-55,-54,-53,-51,-50
+            ,-48,-46,-44,-42,-40,-38,-36,-34,-33,-32,-30,-30,-29,-28,-28,-28
+            ,-28,-28,-28,-28,-28,-28,-28,-27,-27,-26,-25,-24,-23,-21,-19,-18
+            ,-16,-14,-12,-10,-9,-7,-5,-4,-3,-2,-1,-1,0,0,0,0
+            ,0,0,0,0,0,1,1,2,3,4,5,7,9,10,12,14
+            ,16,18,19,21,23,24,25,26,27,27,28,28,28,28,28,28
+            ,28,28,28,28,29,30,30,32,33,34,36,38,40,42,44,46
+            ,48,50,51,53,54,55,56,56,56,56,56,56,56,56,55,55
+            ,55,55,55,56,57,58,59,61,63,65,67,70,72,75,77,79
+            ,81,83,85,86,86,87,87,86,85,85,83,82,81,80,79,79
+            ,78,79,79,81,82,85,88,91,95,99,104,108,112,116,120,123
+            ,125,127,127,126,124,120,115,109,101,92,82,70,57,44,29,15
+          }
+          ,{
+            0,-8,-16,-24,-32,-40,-48,-55,-62,-69,-76,-82,-88,-93,-99,-103
+            ,-108,-112,-115,-118,-121,-123,-124,-126,-127,-127,-127,-127,-126,-125,-124,-122
+            ,-120,-118,-115,-113,-110,-107,-104,-101,-98,-95,-92,-89,-86,-83,-80,-77
+            ,-75,-72,-70,-68,-66,-64,-62,-61,-60,-59,-58,-57,-56,-56,-56,-56
+            ,-55,-55,-56,-56,-56,-56,-57,-57,-57,-58,-58,-58,-58,-58,-58,-58
+            ,-58,-57,-57,-56,-55,-54,-53,-52,-51,-49,-48,-46,-45,-43,-41,-39
+            ,-37,-35,-33,-31,-28,-26,-24,-22,-20,-18,-16,-15,-13,-11,-10,-9
+            ,-7,-6,-5,-4,-3,-3,-2,-1,-1,-1,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,1,1,1,2,3,3,4,5,6
+            ,7,9,10,11,13,15,16,18,20,22,24,26,28,31,33,35
+            ,37,39,41,43,45,46,48,49,51,52,53,54,55,56,57,57
+            ,58,58,58,58,58,58,58,58,57,57,57,56,56,56,56,55
+            ,55,56,56,56,56,57,58,59,60,61,62,64,66,68,70,72
+            ,75,77,80,83,86,89,92,95,98,101,104,107,110,113,115,118
+            ,120,122,124,125,126,127,127,127,127,126,124,123,121,118,115,112
+            ,108,103,99,93,88,82,76,69,62,55,48,40,32,24,16,8
+          }
+          ,{
+            0,-5,-10,-14,-19,-24,-29,-33,-38,-42,-47,-51,-56,-60,-64,-68
+            ,-72,-76,-80,-83,-87,-90,-93,-96,-99,-102,-105,-108,-110,-112,-114,-116
+            ,-118,-120,-121,-122,-124,-124,-125,-126,-126,-127,-127,-127,-127,-127,-126,-126
+            ,-125,-124,-123,-122,-121,-119,-118,-116,-115,-113,-111,-109,-107,-105,-102,-100
+            ,-98,-95,-93,-90,-88,-85,-83,-80,-77,-74,-72,-69,-66,-64,-61,-58
+            ,-56,-53,-51,-48,-46,-43,-41,-38,-36,-34,-32,-30,-28,-26,-24,-22
+            ,-20,-19,-17,-16,-14,-13,-11,-10,-9,-8,-7,-6,-5,-5,-4,-3
+            ,-3,-2,-2,-2,-1,-1,-1,-1,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,2
+            ,3,3,4,5,5,6,7,8,9,10,11,13,14,16,17,19
+            ,20,22,24,26,28,30,32,34,36,38,41,43,46,48,51,53
+            ,56,58,61,64,66,69,72,74,77,80,83,85,88,90,93,95
+            ,98,100,102,105,107,109,111,113,115,116,118,119,121,122,123,124
+            ,125,126,126,127,127,127,127,127,126,126,125,124,124,122,121,120
+            ,118,116,114,112,110,108,105,102,99,96,93,90,87,83,80,76
+            ,72,68,64,60,56,51,47,42,38,33,29,24,19,14,10,5
+          }
+          ,{
+            0,-3,-6,-9,-12,-16,-19,-22,-25,-28,-31,-34,-37,-40,-43,-46
+            ,-49,-51,-54,-57,-60,-63,-65,-68,-71,-73,-76,-78,-81,-83,-85,-88
+            ,-90,-92,-94,-96,-98,-100,-102,-104,-106,-107,-109,-111,-112,-113,-115,-116
+            ,-117,-118,-120,-121,-122,-122,-123,-124,-125,-125,-126,-126,-126,-127,-127,-127
+            ,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-123,-122,-122,-121,-120,-118
+            ,-117,-116,-115,-113,-112,-111,-109,-107,-106,-104,-102,-100,-98,-96,-94,-92
+            ,-90,-88,-85,-83,-81,-78,-76,-73,-71,-68,-65,-63,-60,-57,-54,-51
+            ,-49,-46,-43,-40,-37,-34,-31,-28,-25,-22,-19,-16,-12,-9,-6,-3
+            ,0,3,6,9,12,16,19,22,25,28,31,34,37,40,43,46
+            ,49,51,54,57,60,63,65,68,71,73,76,78,81,83,85,88
+            ,90,92,94,96,98,100,102,104,106,107,109,111,112,113,115,116
+            ,117,118,120,121,122,122,123,124,125,125,126,126,126,127,127,127
+            ,127,127,127,127,126,126,126,125,125,124,123,122,122,121,120,118
+            ,117,116,115,113,112,111,109,107,106,104,102,100,98,96,94,92
+            ,90,88,85,83,81,78,76,73,71,68,65,63,60,57,54,51
+            ,49,46,43,40,37,34,31,28,25,22,19,16,12,9,6,3
+          }
+        };
+
+
+#endif /* SAWBANDLIMITED256_H_ */
@@ -0,0 +1,302 @@
+/*
+  sawbandlimited512_int8.h - band-limited saw tables, one per octave
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  bandlimited saw 128 8
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SAWBANDLIMITED512_H_
+#define SAWBANDLIMITED512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SAWBANDLIMITED512_NUM_CELLS 512
+#define SAWBANDLIMITED512_SAMPLERATE 512
+#define SAWBANDLIMITED512_LEVELS 8
+
+/** @ingroup tables
+sawbandlimited512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SAWBANDLIMITED512_DATA [8][512]  =
+        {
+          {
+            0,-94,-127,-109,-96,-106,-113,-106,-100,-105,-109,-104,-100,-103,-106,-102
+            ,-99,-101,-103,-100,-98,-100,-101,-98,-96,-98,-99,-97,-95,-96,-97,-95
+            ,-94,-95,-95,-93,-92,-93,-93,-92,-90,-91,-92,-90,-89,-90,-90,-88
+            ,-87,-88,-88,-87,-86,-86,-86,-85,-84,-85,-85,-83,-82,-83,-83,-81
+            ,-81,-81,-81,-80,-79,-79,-79,-78,-77,-78,-78,-76,-76,-76,-76,-75
+            ,-74,-74,-74,-73,-72,-73,-72,-71,-71,-71,-71,-70,-69,-69,-69,-68
+            ,-67,-68,-67,-66,-66,-66,-66,-65,-64,-64,-64,-63,-62,-63,-62,-61
+            ,-61,-61,-60,-59,-59,-59,-59,-58,-57,-57,-57,-56,-56,-56,-55,-54
+            ,-54,-54,-54,-53,-52,-52,-52,-51,-51,-51,-50,-49,-49,-49,-49,-48
+            ,-47,-47,-47,-46,-46,-46,-45,-44,-44,-44,-43,-43,-42,-42,-42,-41
+            ,-40,-41,-40,-39,-39,-39,-38,-37,-37,-37,-37,-36,-35,-35,-35,-34
+            ,-34,-34,-33,-32,-32,-32,-31,-31,-30,-30,-30,-29,-29,-29,-28,-27
+            ,-27,-27,-26,-26,-25,-25,-25,-24,-24,-24,-23,-22,-22,-22,-21,-20
+            ,-20,-20,-20,-19,-19,-18,-18,-17,-17,-17,-16,-15,-15,-15,-14,-14
+            ,-14,-13,-13,-12,-12,-12,-11,-10,-10,-10,-9,-9,-8,-8,-8,-7
+            ,-7,-7,-6,-5,-5,-5,-4,-4,-3,-3,-3,-2,-2,-2,-1,0
+            ,0,0,1,2,2,2,3,3,3,4,4,5,5,5,6,7
+            ,7,7,8,8,8,9,9,10,10,10,11,12,12,12,13,13
+            ,14,14,14,15,15,15,16,17,17,17,18,18,19,19,20,20
+            ,20,20,21,22,22,22,23,24,24,24,25,25,25,26,26,27
+            ,27,27,28,29,29,29,30,30,30,31,31,32,32,32,33,34
+            ,34,34,35,35,35,36,37,37,37,37,38,39,39,39,40,41
+            ,40,41,42,42,42,43,43,44,44,44,45,46,46,46,47,47
+            ,47,48,49,49,49,49,50,51,51,51,52,52,52,53,54,54
+            ,54,54,55,56,56,56,57,57,57,58,59,59,59,59,60,61
+            ,61,61,62,63,62,63,64,64,64,65,66,66,66,66,67,68
+            ,67,68,69,69,69,70,71,71,71,71,72,73,72,73,74,74
+            ,74,75,76,76,76,76,78,78,77,78,79,79,79,80,81,81
+            ,81,81,83,83,82,83,85,85,84,85,86,86,86,87,88,88
+            ,87,88,90,90,89,90,92,91,90,92,93,93,92,93,95,95
+            ,94,95,97,96,95,97,99,98,96,98,101,100,98,100,103,101
+            ,99,102,106,103,100,104,109,105,100,106,113,106,96,109,127,94
+          }
+          ,{
+            0,-53,-95,-120,-127,-121,-109,-99,-95,-98,-104,-110,-111,-108,-103,-99
+            ,-97,-98,-102,-104,-105,-103,-99,-96,-95,-96,-98,-100,-100,-99,-96,-94
+            ,-93,-94,-95,-96,-96,-95,-93,-91,-90,-91,-92,-93,-92,-91,-89,-87
+            ,-87,-87,-88,-89,-89,-87,-86,-84,-84,-84,-85,-85,-85,-84,-82,-81
+            ,-81,-81,-82,-82,-81,-80,-79,-78,-77,-78,-78,-78,-78,-77,-75,-74
+            ,-74,-74,-75,-75,-74,-73,-72,-71,-71,-71,-71,-71,-71,-70,-69,-68
+            ,-67,-68,-68,-68,-67,-66,-65,-64,-64,-64,-64,-64,-64,-63,-62,-61
+            ,-61,-61,-61,-61,-60,-59,-58,-58,-57,-58,-58,-58,-57,-56,-55,-54
+            ,-54,-54,-54,-54,-53,-52,-51,-51,-51,-51,-51,-51,-50,-49,-48,-47
+            ,-47,-47,-47,-47,-46,-46,-45,-44,-44,-44,-44,-44,-43,-42,-41,-41
+            ,-41,-41,-41,-40,-40,-39,-38,-37,-37,-37,-37,-37,-36,-35,-34,-34
+            ,-34,-34,-34,-33,-33,-32,-31,-31,-30,-30,-30,-30,-29,-28,-28,-27
+            ,-27,-27,-27,-27,-26,-25,-24,-24,-24,-24,-24,-23,-22,-21,-21,-20
+            ,-20,-20,-20,-20,-19,-18,-17,-17,-17,-17,-17,-16,-15,-15,-14,-14
+            ,-14,-14,-13,-13,-12,-11,-11,-10,-10,-10,-10,-9,-9,-8,-7,-7
+            ,-7,-7,-7,-6,-5,-4,-4,-3,-3,-3,-3,-3,-2,-1,0,0
+            ,0,0,0,1,2,3,3,3,3,3,4,4,5,6,7,7
+            ,7,7,7,8,9,9,10,10,10,10,11,11,12,13,13,14
+            ,14,14,14,15,15,16,17,17,17,17,17,18,19,20,20,20
+            ,20,20,21,21,22,23,24,24,24,24,24,25,26,27,27,27
+            ,27,27,28,28,29,30,30,30,30,31,31,32,33,33,34,34
+            ,34,34,34,35,36,37,37,37,37,37,38,39,40,40,41,41
+            ,41,41,41,42,43,44,44,44,44,44,45,46,46,47,47,47
+            ,47,47,48,49,50,51,51,51,51,51,51,52,53,54,54,54
+            ,54,54,55,56,57,58,58,58,57,58,58,59,60,61,61,61
+            ,61,61,62,63,64,64,64,64,64,64,65,66,67,68,68,68
+            ,67,68,69,70,71,71,71,71,71,71,72,73,74,75,75,74
+            ,74,74,75,77,78,78,78,78,77,78,79,80,81,82,82,81
+            ,81,81,82,84,85,85,85,84,84,84,86,87,89,89,88,87
+            ,87,87,89,91,92,93,92,91,90,91,93,95,96,96,95,94
+            ,93,94,96,99,100,100,98,96,95,96,99,103,105,104,102,98
+            ,97,99,103,108,111,110,104,98,95,99,109,121,127,120,95,53
+          }
+          ,{
+            0,-27,-53,-77,-96,-111,-121,-126,-127,-125,-120,-114,-107,-101,-97,-94
+            ,-93,-94,-96,-99,-102,-105,-107,-108,-108,-106,-104,-101,-98,-95,-93,-92
+            ,-91,-92,-93,-94,-96,-97,-98,-98,-98,-97,-95,-93,-91,-89,-87,-87
+            ,-86,-87,-87,-88,-89,-90,-90,-90,-90,-88,-87,-85,-84,-82,-81,-81
+            ,-80,-81,-81,-82,-82,-83,-83,-83,-82,-81,-80,-78,-77,-76,-75,-74
+            ,-74,-74,-75,-75,-75,-76,-76,-75,-74,-73,-72,-71,-70,-69,-68,-68
+            ,-68,-68,-68,-68,-68,-69,-68,-68,-67,-66,-65,-64,-63,-62,-61,-61
+            ,-61,-61,-61,-61,-62,-62,-61,-61,-60,-59,-58,-57,-56,-55,-55,-54
+            ,-54,-54,-54,-55,-55,-55,-54,-54,-53,-52,-51,-50,-49,-48,-48,-48
+            ,-48,-48,-48,-48,-48,-48,-47,-47,-46,-45,-44,-43,-42,-42,-41,-41
+            ,-41,-41,-41,-41,-41,-41,-40,-40,-39,-38,-37,-36,-35,-35,-34,-34
+            ,-34,-34,-34,-34,-34,-34,-33,-32,-32,-31,-30,-29,-28,-28,-27,-27
+            ,-27,-27,-27,-27,-27,-27,-26,-25,-25,-24,-23,-22,-21,-21,-21,-20
+            ,-20,-20,-20,-20,-20,-20,-19,-18,-18,-17,-16,-15,-14,-14,-14,-14
+            ,-14,-14,-14,-13,-13,-13,-12,-11,-11,-10,-9,-8,-8,-7,-7,-7
+            ,-7,-7,-7,-7,-6,-6,-5,-4,-4,-3,-2,-1,-1,0,0,0
+            ,0,0,0,0,1,1,2,3,4,4,5,6,6,7,7,7
+            ,7,7,7,7,8,8,9,10,11,11,12,13,13,13,14,14
+            ,14,14,14,14,14,15,16,17,18,18,19,20,20,20,20,20
+            ,20,20,21,21,21,22,23,24,25,25,26,27,27,27,27,27
+            ,27,27,27,28,28,29,30,31,32,32,33,34,34,34,34,34
+            ,34,34,34,35,35,36,37,38,39,40,40,41,41,41,41,41
+            ,41,41,41,42,42,43,44,45,46,47,47,48,48,48,48,48
+            ,48,48,48,48,49,50,51,52,53,54,54,55,55,55,54,54
+            ,54,54,55,55,56,57,58,59,60,61,61,62,62,61,61,61
+            ,61,61,61,62,63,64,65,66,67,68,68,69,68,68,68,68
+            ,68,68,68,69,70,71,72,73,74,75,76,76,75,75,75,74
+            ,74,74,75,76,77,78,80,81,82,83,83,83,82,82,81,81
+            ,80,81,81,82,84,85,87,88,90,90,90,90,89,88,87,87
+            ,86,87,87,89,91,93,95,97,98,98,98,97,96,94,93,92
+            ,91,92,93,95,98,101,104,106,108,108,107,105,102,99,96,94
+            ,93,94,97,101,107,114,120,125,127,126,121,111,96,77,53,27
+          }
+          ,{
+            0,-14,-28,-42,-55,-67,-78,-89,-98,-106,-112,-118,-122,-125,-126,-127
+            ,-127,-125,-123,-121,-117,-114,-110,-107,-103,-100,-97,-94,-92,-91,-89,-89
+            ,-88,-89,-89,-90,-91,-93,-94,-95,-97,-98,-99,-100,-101,-101,-101,-100
+            ,-99,-98,-97,-96,-94,-92,-90,-89,-87,-85,-84,-83,-82,-81,-80,-80
+            ,-80,-80,-80,-81,-81,-82,-82,-83,-83,-84,-84,-84,-84,-84,-84,-83
+            ,-82,-81,-80,-79,-78,-76,-75,-74,-72,-71,-70,-69,-69,-68,-68,-68
+            ,-68,-68,-68,-68,-68,-69,-69,-69,-69,-70,-70,-69,-69,-69,-68,-67
+            ,-67,-66,-65,-64,-62,-61,-60,-59,-58,-57,-57,-56,-55,-55,-55,-55
+            ,-54,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-55,-54,-54,-53,-52
+            ,-51,-51,-50,-49,-48,-47,-46,-45,-44,-43,-43,-42,-42,-41,-41,-41
+            ,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-41,-40,-40,-39,-38,-38
+            ,-37,-36,-35,-34,-33,-32,-31,-30,-30,-29,-29,-28,-28,-28,-28,-27
+            ,-27,-27,-27,-28,-28,-27,-27,-27,-27,-27,-26,-26,-25,-24,-24,-23
+            ,-22,-21,-20,-19,-18,-18,-17,-16,-16,-15,-15,-14,-14,-14,-14,-14
+            ,-14,-14,-14,-14,-14,-14,-13,-13,-13,-12,-12,-11,-11,-10,-9,-8
+            ,-7,-6,-6,-5,-4,-3,-2,-2,-1,-1,-1,0,0,0,0,0
+            ,0,0,0,0,0,0,1,1,1,2,2,3,4,5,6,6
+            ,7,8,9,10,11,11,12,12,13,13,13,14,14,14,14,14
+            ,14,14,14,14,14,14,15,15,16,16,17,18,18,19,20,21
+            ,22,23,24,24,25,26,26,27,27,27,27,27,28,28,27,27
+            ,27,27,28,28,28,28,29,29,30,30,31,32,33,34,35,36
+            ,37,38,38,39,40,40,41,41,41,41,41,41,41,41,41,41
+            ,41,41,41,41,42,42,43,43,44,45,46,47,48,49,50,51
+            ,51,52,53,54,54,55,55,55,55,55,55,55,55,55,55,55
+            ,54,55,55,55,55,56,57,57,58,59,60,61,62,64,65,66
+            ,67,67,68,69,69,69,70,70,69,69,69,69,68,68,68,68
+            ,68,68,68,68,69,69,70,71,72,74,75,76,78,79,80,81
+            ,82,83,84,84,84,84,84,84,83,83,82,82,81,81,80,80
+            ,80,80,80,81,82,83,84,85,87,89,90,92,94,96,97,98
+            ,99,100,101,101,101,100,99,98,97,95,94,93,91,90,89,89
+            ,88,89,89,91,92,94,97,100,103,107,110,114,117,121,123,125
+            ,127,127,126,125,122,118,112,106,98,89,78,67,55,42,28,14
+          }
+          ,{
+            0,-7,-15,-22,-29,-37,-44,-51,-57,-64,-70,-76,-82,-87,-92,-97
+            ,-101,-105,-109,-112,-115,-118,-120,-122,-124,-125,-126,-127,-127,-127,-127,-126
+            ,-125,-124,-123,-122,-120,-118,-116,-114,-112,-110,-108,-106,-104,-101,-99,-97
+            ,-95,-93,-91,-89,-88,-86,-85,-84,-82,-82,-81,-80,-79,-79,-79,-78
+            ,-78,-78,-79,-79,-79,-80,-80,-81,-81,-82,-82,-83,-83,-84,-85,-85
+            ,-85,-86,-86,-86,-87,-87,-87,-86,-86,-86,-86,-85,-85,-84,-83,-82
+            ,-81,-80,-79,-78,-77,-76,-75,-74,-72,-71,-70,-69,-67,-66,-65,-64
+            ,-63,-62,-61,-60,-59,-59,-58,-57,-57,-56,-56,-56,-55,-55,-55,-55
+            ,-55,-55,-55,-55,-55,-55,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56
+            ,-56,-56,-56,-56,-56,-55,-55,-54,-54,-53,-53,-52,-51,-50,-50,-49
+            ,-48,-47,-46,-45,-44,-43,-42,-41,-40,-39,-38,-37,-36,-35,-34,-34
+            ,-33,-32,-32,-31,-30,-30,-30,-29,-29,-29,-28,-28,-28,-28,-28,-28
+            ,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-27,-27
+            ,-27,-26,-26,-26,-25,-25,-24,-23,-23,-22,-21,-20,-19,-19,-18,-17
+            ,-16,-15,-14,-13,-12,-11,-10,-9,-9,-8,-7,-6,-5,-5,-4,-4
+            ,-3,-3,-2,-2,-1,-1,-1,-1,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,3
+            ,3,4,4,5,5,6,7,8,9,9,10,11,12,13,14,15
+            ,16,17,18,19,19,20,21,22,23,23,24,25,25,26,26,26
+            ,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28
+            ,28,28,28,28,28,28,28,29,29,29,30,30,30,31,32,32
+            ,33,34,34,35,36,37,38,39,40,41,42,43,44,45,46,47
+            ,48,49,50,50,51,52,53,53,54,54,55,55,56,56,56,56
+            ,56,56,56,56,56,56,56,56,56,56,56,55,55,55,55,55
+            ,55,55,55,55,55,56,56,56,57,57,58,59,59,60,61,62
+            ,63,64,65,66,67,69,70,71,72,74,75,76,77,78,79,80
+            ,81,82,83,84,85,85,86,86,86,86,87,87,87,86,86,86
+            ,85,85,85,84,83,83,82,82,81,81,80,80,79,79,79,78
+            ,78,78,79,79,79,80,81,82,82,84,85,86,88,89,91,93
+            ,95,97,99,101,104,106,108,110,112,114,116,118,120,122,123,124
+            ,125,126,127,127,127,127,126,125,124,122,120,118,115,112,109,105
+            ,101,97,92,87,82,76,70,64,57,51,44,37,29,22,15,7
+          }
+          ,{
+            0,-4,-8,-12,-16,-20,-24,-28,-32,-36,-40,-44,-48,-51,-55,-59
+            ,-62,-66,-69,-72,-76,-79,-82,-85,-88,-91,-93,-96,-99,-101,-103,-106
+            ,-108,-110,-112,-113,-115,-117,-118,-119,-121,-122,-123,-124,-124,-125,-126,-126
+            ,-126,-127,-127,-127,-127,-127,-127,-126,-126,-125,-125,-124,-124,-123,-122,-121
+            ,-120,-119,-118,-117,-115,-114,-113,-112,-110,-109,-107,-106,-104,-103,-101,-100
+            ,-98,-97,-95,-94,-92,-91,-89,-87,-86,-85,-83,-82,-80,-79,-77,-76
+            ,-75,-74,-72,-71,-70,-69,-68,-67,-66,-65,-64,-63,-62,-62,-61,-60
+            ,-60,-59,-59,-58,-58,-57,-57,-57,-56,-56,-56,-56,-56,-56,-55,-55
+            ,-55,-55,-55,-56,-56,-56,-56,-56,-56,-56,-56,-57,-57,-57,-57,-57
+            ,-57,-57,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58,-58
+            ,-58,-57,-57,-57,-57,-56,-56,-56,-55,-55,-54,-54,-53,-53,-52,-51
+            ,-51,-50,-49,-49,-48,-47,-46,-45,-45,-44,-43,-42,-41,-40,-39,-38
+            ,-37,-36,-35,-34,-33,-32,-31,-30,-28,-27,-26,-25,-24,-23,-22,-21
+            ,-20,-19,-18,-17,-16,-16,-15,-14,-13,-12,-11,-11,-10,-9,-9,-8
+            ,-7,-7,-6,-6,-5,-5,-4,-4,-3,-3,-3,-2,-2,-2,-1,-1
+            ,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1
+            ,1,1,1,2,2,2,3,3,3,4,4,5,5,6,6,7
+            ,7,8,9,9,10,11,11,12,13,14,15,16,16,17,18,19
+            ,20,21,22,23,24,25,26,27,28,30,31,32,33,34,35,36
+            ,37,38,39,40,41,42,43,44,45,45,46,47,48,49,49,50
+            ,51,51,52,53,53,54,54,55,55,56,56,56,57,57,57,57
+            ,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,57
+            ,57,57,57,57,57,57,56,56,56,56,56,56,56,56,55,55
+            ,55,55,55,56,56,56,56,56,56,57,57,57,58,58,59,59
+            ,60,60,61,62,62,63,64,65,66,67,68,69,70,71,72,74
+            ,75,76,77,79,80,82,83,85,86,87,89,91,92,94,95,97
+            ,98,100,101,103,104,106,107,109,110,112,113,114,115,117,118,119
+            ,120,121,122,123,124,124,125,125,126,126,127,127,127,127,127,127
+            ,126,126,126,125,124,124,123,122,121,119,118,117,115,113,112,110
+            ,108,106,103,101,99,96,93,91,88,85,82,79,76,72,69,66
+            ,62,59,55,51,48,44,40,36,32,28,24,20,16,12,8,4
+          }
+          ,{
+            0,-2,-5,-7,-10,-12,-14,-17,-19,-21,-24,-26,-29,-31,-33,-35
+            ,-38,-40,-42,-45,-47,-49,-51,-53,-56,-58,-60,-62,-64,-66,-68,-70
+            ,-72,-74,-76,-78,-80,-81,-83,-85,-87,-88,-90,-92,-93,-95,-96,-98
+            ,-99,-101,-102,-104,-105,-106,-108,-109,-110,-111,-112,-113,-114,-115,-116,-117
+            ,-118,-119,-120,-120,-121,-122,-122,-123,-124,-124,-124,-125,-125,-126,-126,-126
+            ,-126,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-126,-125
+            ,-125,-124,-124,-124,-123,-123,-122,-121,-121,-120,-119,-119,-118,-117,-116,-115
+            ,-115,-114,-113,-112,-111,-110,-109,-108,-107,-106,-105,-104,-102,-101,-100,-99
+            ,-98,-97,-95,-94,-93,-92,-90,-89,-88,-86,-85,-84,-83,-81,-80,-79
+            ,-77,-76,-74,-73,-72,-70,-69,-68,-66,-65,-64,-62,-61,-60,-58,-57
+            ,-56,-54,-53,-52,-51,-49,-48,-47,-46,-44,-43,-42,-41,-40,-38,-37
+            ,-36,-35,-34,-33,-32,-31,-30,-29,-28,-27,-26,-25,-24,-23,-22,-21
+            ,-20,-19,-19,-18,-17,-16,-16,-15,-14,-13,-13,-12,-11,-11,-10,-10
+            ,-9,-9,-8,-8,-7,-7,-6,-6,-5,-5,-5,-4,-4,-4,-3,-3
+            ,-3,-3,-2,-2,-2,-2,-2,-1,-1,-1,-1,-1,-1,-1,-1,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,1,1,1,1,1,1,1,1,2,2,2,2,2,3
+            ,3,3,3,4,4,4,5,5,5,6,6,7,7,8,8,9
+            ,9,10,10,11,11,12,13,13,14,15,16,16,17,18,19,19
+            ,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35
+            ,36,37,38,40,41,42,43,44,46,47,48,49,51,52,53,54
+            ,56,57,58,60,61,62,64,65,66,68,69,70,72,73,74,76
+            ,77,79,80,81,83,84,85,86,88,89,90,92,93,94,95,97
+            ,98,99,100,101,102,104,105,106,107,108,109,110,111,112,113,114
+            ,115,115,116,117,118,119,119,120,121,121,122,123,123,124,124,124
+            ,125,125,126,126,126,126,127,127,127,127,127,127,127,127,127,127
+            ,126,126,126,126,125,125,124,124,124,123,122,122,121,120,120,119
+            ,118,117,116,115,114,113,112,111,110,109,108,106,105,104,102,101
+            ,99,98,96,95,93,92,90,88,87,85,83,81,80,78,76,74
+            ,72,70,68,66,64,62,60,58,56,53,51,49,47,45,42,40
+            ,38,35,33,31,29,26,24,21,19,17,14,12,10,7,5,2
+          }
+          ,{
+            0,-2,-3,-5,-6,-8,-9,-11,-12,-14,-16,-17,-19,-20,-22,-23
+            ,-25,-26,-28,-29,-31,-32,-34,-35,-37,-38,-40,-41,-43,-44,-46,-47
+            ,-49,-50,-51,-53,-54,-56,-57,-58,-60,-61,-63,-64,-65,-67,-68,-69
+            ,-71,-72,-73,-74,-76,-77,-78,-79,-81,-82,-83,-84,-85,-86,-88,-89
+            ,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105
+            ,-106,-106,-107,-108,-109,-110,-111,-111,-112,-113,-113,-114,-115,-115,-116,-117
+            ,-117,-118,-118,-119,-120,-120,-121,-121,-122,-122,-122,-123,-123,-124,-124,-124
+            ,-125,-125,-125,-125,-126,-126,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127
+            ,-127,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-126,-126,-125,-125,-125
+            ,-125,-124,-124,-124,-123,-123,-122,-122,-122,-121,-121,-120,-120,-119,-118,-118
+            ,-117,-117,-116,-115,-115,-114,-113,-113,-112,-111,-111,-110,-109,-108,-107,-106
+            ,-106,-105,-104,-103,-102,-101,-100,-99,-98,-97,-96,-95,-94,-93,-92,-91
+            ,-90,-89,-88,-86,-85,-84,-83,-82,-81,-79,-78,-77,-76,-74,-73,-72
+            ,-71,-69,-68,-67,-65,-64,-63,-61,-60,-58,-57,-56,-54,-53,-51,-50
+            ,-49,-47,-46,-44,-43,-41,-40,-38,-37,-35,-34,-32,-31,-29,-28,-26
+            ,-25,-23,-22,-20,-19,-17,-16,-14,-12,-11,-9,-8,-6,-5,-3,-2
+            ,0,2,3,5,6,8,9,11,12,14,16,17,19,20,22,23
+            ,25,26,28,29,31,32,34,35,37,38,40,41,43,44,46,47
+            ,49,50,51,53,54,56,57,58,60,61,63,64,65,67,68,69
+            ,71,72,73,74,76,77,78,79,81,82,83,84,85,86,88,89
+            ,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105
+            ,106,106,107,108,109,110,111,111,112,113,113,114,115,115,116,117
+            ,117,118,118,119,120,120,121,121,122,122,122,123,123,124,124,124
+            ,125,125,125,125,126,126,126,126,126,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,126,126,126,126,126,125,125,125
+            ,125,124,124,124,123,123,122,122,122,121,121,120,120,119,118,118
+            ,117,117,116,115,115,114,113,113,112,111,111,110,109,108,107,106
+            ,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91
+            ,90,89,88,86,85,84,83,82,81,79,78,77,76,74,73,72
+            ,71,69,68,67,65,64,63,61,60,58,57,56,54,53,51,50
+            ,49,47,46,44,43,41,40,38,37,35,34,32,31,29,28,26
+            ,25,23,22,20,19,17,16,14,12,11,9,8,6,5,3,2
+          }
+        };
+
+
+#endif /* SAWBANDLIMITED512_H_ */
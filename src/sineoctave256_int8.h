@@ -0,0 +1,45 @@
+/*
+  sineoctave256_int8.h - sine with an octave
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0.5
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SINEOCTAVE256_H_
+#define SINEOCTAVE256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SINEOCTAVE256_NUM_CELLS 256
+#define SINEOCTAVE256_SAMPLERATE 256
+
+/** @ingroup tables
+sineoctave256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SINEOCTAVE256_DATA [256]  =
+        {
+            0,5,10,14,19,24,29,33,38,42,47,51,56,60,64,68
+            ,72,76,80,83,87,90,93,96,99,102,105,108,110,112,114,116
+            ,118,120,121,122,124,124,125,126,126,127,127,127,127,127,126,126
+            ,125,124,123,122,121,119,118,116,115,113,111,109,107,105,102,100
+            ,98,95,93,90,88,85,83,80,77,74,72,69,66,64,61,58
+            ,56,53,51,48,46,43,41,38,36,34,32,30,28,26,24,22
+            ,20,19,17,16,14,13,11,10,9,8,7,6,5,5,4,3
+            ,3,2,2,2,1,1,1,1,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-2,-2,-2
+            ,-3,-3,-4,-5,-5,-6,-7,-8,-9,-10,-11,-13,-14,-16,-17,-19
+            ,-20,-22,-24,-26,-28,-30,-32,-34,-36,-38,-41,-43,-46,-48,-51,-53
+            ,-56,-58,-61,-64,-66,-69,-72,-74,-77,-80,-83,-85,-88,-90,-93,-95
+            ,-98,-100,-102,-105,-107,-109,-111,-113,-115,-116,-118,-119,-121,-122,-123,-124
+            ,-125,-126,-126,-127,-127,-127,-127,-127,-126,-126,-125,-124,-124,-122,-121,-120
+            ,-118,-116,-114,-112,-110,-108,-105,-102,-99,-96,-93,-90,-87,-83,-80,-76
+            ,-72,-68,-64,-60,-56,-51,-47,-42,-38,-33,-29,-24,-19,-14,-10,-5
+        };
+
+
+#endif /* SINEOCTAVE256_H_ */
@@ -0,0 +1,61 @@
+/*
+  sineoctave512_int8.h - sine with an octave
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0.5
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SINEOCTAVE512_H_
+#define SINEOCTAVE512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SINEOCTAVE512_NUM_CELLS 512
+#define SINEOCTAVE512_SAMPLERATE 512
+
+/** @ingroup tables
+sineoctave512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SINEOCTAVE512_DATA [512]  =
+        {
+            0,2,5,7,10,12,14,17,19,21,24,26,29,31,33,35
+            ,38,40,42,45,47,49,51,53,56,58,60,62,64,66,68,70
+            ,72,74,76,78,80,81,83,85,87,88,90,92,93,95,96,98
+            ,99,101,102,104,105,106,108,109,110,111,112,113,114,115,116,117
+            ,118,119,120,120,121,122,122,123,124,124,124,125,125,126,126,126
+            ,126,127,127,127,127,127,127,127,127,127,127,126,126,126,126,125
+            ,125,124,124,124,123,123,122,121,121,120,119,119,118,117,116,115
+            ,115,114,113,112,111,110,109,108,107,106,105,104,102,101,100,99
+            ,98,97,95,94,93,92,90,89,88,86,85,84,83,81,80,79
+            ,77,76,74,73,72,70,69,68,66,65,64,62,61,60,58,57
+            ,56,54,53,52,51,49,48,47,46,44,43,42,41,40,38,37
+            ,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21
+            ,20,19,19,18,17,16,16,15,14,13,13,12,11,11,10,10
+            ,9,9,8,8,7,7,6,6,5,5,5,4,4,4,3,3
+            ,3,3,2,2,2,2,2,1,1,1,1,1,1,1,1,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+            ,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-3
+            ,-3,-3,-3,-4,-4,-4,-5,-5,-5,-6,-6,-7,-7,-8,-8,-9
+            ,-9,-10,-10,-11,-11,-12,-13,-13,-14,-15,-16,-16,-17,-18,-19,-19
+            ,-20,-21,-22,-23,-24,-25,-26,-27,-28,-29,-30,-31,-32,-33,-34,-35
+            ,-36,-37,-38,-40,-41,-42,-43,-44,-46,-47,-48,-49,-51,-52,-53,-54
+            ,-56,-57,-58,-60,-61,-62,-64,-65,-66,-68,-69,-70,-72,-73,-74,-76
+            ,-77,-79,-80,-81,-83,-84,-85,-86,-88,-89,-90,-92,-93,-94,-95,-97
+            ,-98,-99,-100,-101,-102,-104,-105,-106,-107,-108,-109,-110,-111,-112,-113,-114
+            ,-115,-115,-116,-117,-118,-119,-119,-120,-121,-121,-122,-123,-123,-124,-124,-124
+            ,-125,-125,-126,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127,-127,-127,-127
+            ,-126,-126,-126,-126,-125,-125,-124,-124,-124,-123,-122,-122,-121,-120,-120,-119
+            ,-118,-117,-116,-115,-114,-113,-112,-111,-110,-109,-108,-106,-105,-104,-102,-101
+            ,-99,-98,-96,-95,-93,-92,-90,-88,-87,-85,-83,-81,-80,-78,-76,-74
+            ,-72,-70,-68,-66,-64,-62,-60,-58,-56,-53,-51,-49,-47,-45,-42,-40
+            ,-38,-35,-33,-31,-29,-26,-24,-21,-19,-17,-14,-12,-10,-7,-5,-2
+        };
+
+
+#endif /* SINEOCTAVE512_H_ */
@@ -0,0 +1,45 @@
+/*
+  sinetwelfth256_int8.h - sine with an octave & a fifth
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0 0.5
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SINETWELFTH256_H_
+#define SINETWELFTH256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SINETWELFTH256_NUM_CELLS 256
+#define SINETWELFTH256_SAMPLERATE 256
+
+/** @ingroup tables
+sinetwelfth256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SINETWELFTH256_DATA [256]  =
+        {
+            0,7,14,22,29,36,43,49,56,62,68,74,80,85,90,95
+            ,100,104,108,111,114,117,120,122,124,125,126,127,127,127,127,126
+            ,125,124,123,121,119,117,115,112,110,107,104,101,98,95,92,89
+            ,86,84,81,78,76,73,71,69,67,65,63,62,61,60,60,59
+            ,59,59,60,60,61,62,63,65,67,69,71,73,76,78,81,84
+            ,86,89,92,95,98,101,104,107,110,112,115,117,119,121,123,124
+            ,125,126,127,127,127,127,126,125,124,122,120,117,114,111,108,104
+            ,100,95,90,85,80,74,68,62,56,49,43,36,29,22,14,7
+            ,0,-7,-14,-22,-29,-36,-43,-49,-56,-62,-68,-74,-80,-85,-90,-95
+            ,-100,-104,-108,-111,-114,-117,-120,-122,-124,-125,-126,-127,-127,-127,-127,-126
+            ,-125,-124,-123,-121,-119,-117,-115,-112,-110,-107,-104,-101,-98,-95,-92,-89
+            ,-86,-84,-81,-78,-76,-73,-71,-69,-67,-65,-63,-62,-61,-60,-60,-59
+            ,-59,-59,-60,-60,-61,-62,-63,-65,-67,-69,-71,-73,-76,-78,-81,-84
+            ,-86,-89,-92,-95,-98,-101,-104,-107,-110,-112,-115,-117,-119,-121,-123,-124
+            ,-125,-126,-127,-127,-127,-127,-126,-125,-124,-122,-120,-117,-114,-111,-108,-104
+            ,-100,-95,-90,-85,-80,-74,-68,-62,-56,-49,-43,-36,-29,-22,-14,-7
+        };
+
+
+#endif /* SINETWELFTH256_H_ */
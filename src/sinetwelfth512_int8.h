@@ -0,0 +1,61 @@
+/*
+  sinetwelfth512_int8.h - sine with an octave & a fifth
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0 0.5
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SINETWELFTH512_H_
+#define SINETWELFTH512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SINETWELFTH512_NUM_CELLS 512
+#define SINETWELFTH512_SAMPLERATE 512
+
+/** @ingroup tables
+sinetwelfth512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SINETWELFTH512_DATA [512]  =
+        {
+            0,4,7,11,14,18,22,25,29,32,36,39,43,46,49,53
+            ,56,59,62,65,68,71,74,77,80,83,85,88,90,93,95,97
+            ,100,102,104,106,108,110,111,113,114,116,117,118,120,121,122,123
+            ,123,124,125,125,126,126,127,127,127,127,127,127,127,126,126,126
+            ,125,125,124,123,123,122,121,120,119,118,117,116,115,114,112,111
+            ,110,108,107,106,104,103,101,100,98,97,95,94,92,91,89,88
+            ,86,85,84,82,81,79,78,77,76,74,73,72,71,70,69,68
+            ,67,66,65,64,63,63,62,62,61,61,60,60,60,59,59,59
+            ,59,59,59,59,60,60,60,61,61,62,62,63,63,64,65,66
+            ,67,68,69,70,71,72,73,74,76,77,78,79,81,82,84,85
+            ,86,88,89,91,92,94,95,97,98,100,101,103,104,106,107,108
+            ,110,111,112,114,115,116,117,118,119,120,121,122,123,123,124,125
+            ,125,126,126,126,127,127,127,127,127,127,127,126,126,125,125,124
+            ,123,123,122,121,120,118,117,116,114,113,111,110,108,106,104,102
+            ,100,97,95,93,90,88,85,83,80,77,74,71,68,65,62,59
+            ,56,53,49,46,43,39,36,32,29,25,22,18,14,11,7,4
+            ,0,-4,-7,-11,-14,-18,-22,-25,-29,-32,-36,-39,-43,-46,-49,-53
+            ,-56,-59,-62,-65,-68,-71,-74,-77,-80,-83,-85,-88,-90,-93,-95,-97
+            ,-100,-102,-104,-106,-108,-110,-111,-113,-114,-116,-117,-118,-120,-121,-122,-123
+            ,-123,-124,-125,-125,-126,-126,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126
+            ,-125,-125,-124,-123,-123,-122,-121,-120,-119,-118,-117,-116,-115,-114,-112,-111
+            ,-110,-108,-107,-106,-104,-103,-101,-100,-98,-97,-95,-94,-92,-91,-89,-88
+            ,-86,-85,-84,-82,-81,-79,-78,-77,-76,-74,-73,-72,-71,-70,-69,-68
+            ,-67,-66,-65,-64,-63,-63,-62,-62,-61,-61,-60,-60,-60,-59,-59,-59
+            ,-59,-59,-59,-59,-60,-60,-60,-61,-61,-62,-62,-63,-63,-64,-65,-66
+            ,-67,-68,-69,-70,-71,-72,-73,-74,-76,-77,-78,-79,-81,-82,-84,-85
+            ,-86,-88,-89,-91,-92,-94,-95,-97,-98,-100,-101,-103,-104,-106,-107,-108
+            ,-110,-111,-112,-114,-115,-116,-117,-118,-119,-120,-121,-122,-123,-123,-124,-125
+            ,-125,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127,-126,-126,-125,-125,-124
+            ,-123,-123,-122,-121,-120,-118,-117,-116,-114,-113,-111,-110,-108,-106,-104,-102
+            ,-100,-97,-95,-93,-90,-88,-85,-83,-80,-77,-74,-71,-68,-65,-62,-59
+            ,-56,-53,-49,-46,-43,-39,-36,-32,-29,-25,-22,-18,-14,-11,-7,-4
+        };
+
+
+#endif /* SINETWELFTH512_H_ */
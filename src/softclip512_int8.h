@@ -0,0 +1,65 @@
+/*
+  SOFTCLIP512_int8.h - defines the saturation curve for the voice mix with ENABLE_SOFT_CLIP_MIXER
+
+  maps the sum of the two voices, -256 to 255 at index 0-511, to an 8 bit output sample.  a gain of 0.6, linear 
+  up to an output of 96, then a tanh knee with the same slope where it starts, rounding off to reach full scale 
+  at the largest sum:
+      |sum| <= 160    0.6 * sum
+      |sum| >  160    96 + 31 * tanh((|sum| - 160) / 54.9) / tanh(96 / 54.9), with the sign of the sum
+  see softClipVoiceMix() in avSource.h and host/softClipMeasure.cpp
+
+  can be replaced with any values you like, but must be 512 cells
+*/
+#ifndef SOFTCLIP512_H_
+#define SOFTCLIP512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SOFTCLIP512_NUM_CELLS 512
+
+/** @ingroup tables
+voice mix saturation curve
+*/
+
+CONSTTABLE_STORAGE(int8_t) SOFTCLIP512_DATA [512]  =
+        {
+            -127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-126,-126,-126,-126,-126,-126
+            ,-126,-125,-125,-125,-125,-125,-125,-125,-124,-124,-124,-124,-124,-124,-123,-123
+            ,-123,-123,-123,-122,-122,-122,-122,-122,-121,-121,-121,-121,-120,-120,-120,-119
+            ,-119,-119,-119,-118,-118,-118,-117,-117,-116,-116,-116,-115,-115,-115,-114,-114
+            ,-113,-113,-112,-112,-111,-111,-111,-110,-110,-109,-109,-108,-107,-107,-106,-106
+            ,-105,-105,-104,-104,-103,-103,-102,-101,-101,-100,-100,-99,-98,-98,-97,-97
+            ,-96,-95,-95,-94,-94,-93,-92,-92,-91,-91,-90,-89,-89,-88,-88,-87
+            ,-86,-86,-85,-85,-84,-83,-83,-82,-82,-81,-80,-80,-79,-79,-78,-77
+            ,-77,-76,-76,-75,-74,-74,-73,-73,-72,-71,-71,-70,-70,-69,-68,-68
+            ,-67,-67,-66,-65,-65,-64,-64,-63,-62,-62,-61,-61,-60,-59,-59,-58
+            ,-58,-57,-56,-56,-55,-55,-54,-53,-53,-52,-52,-51,-50,-50,-49,-49
+            ,-48,-47,-47,-46,-46,-45,-44,-44,-43,-43,-42,-41,-41,-40,-40,-39
+            ,-38,-38,-37,-37,-36,-35,-35,-34,-34,-33,-32,-32,-31,-31,-30,-29
+            ,-29,-28,-28,-27,-26,-26,-25,-25,-24,-23,-23,-22,-22,-21,-20,-20
+            ,-19,-19,-18,-17,-17,-16,-16,-15,-14,-14,-13,-13,-12,-11,-11,-10
+            ,-10,-9,-8,-8,-7,-7,-6,-5,-5,-4,-4,-3,-2,-2,-1,-1
+            ,0,1,1,2,2,3,4,4,5,5,6,7,7,8,8,9
+            ,10,10,11,11,12,13,13,14,14,15,16,16,17,17,18,19
+            ,19,20,20,21,22,22,23,23,24,25,25,26,26,27,28,28
+            ,29,29,30,31,31,32,32,33,34,34,35,35,36,37,37,38
+            ,38,39,40,40,41,41,42,43,43,44,44,45,46,46,47,47
+            ,48,49,49,50,50,51,52,52,53,53,54,55,55,56,56,57
+            ,58,58,59,59,60,61,61,62,62,63,64,64,65,65,66,67
+            ,67,68,68,69,70,70,71,71,72,73,73,74,74,75,76,76
+            ,77,77,78,79,79,80,80,81,82,82,83,83,84,85,85,86
+            ,86,87,88,88,89,89,90,91,91,92,92,93,94,94,95,95
+            ,96,97,97,98,98,99,100,100,101,101,102,103,103,104,104,105
+            ,105,106,106,107,107,108,109,109,110,110,111,111,111,112,112,113
+            ,113,114,114,115,115,115,116,116,116,117,117,118,118,118,119,119
+            ,119,119,120,120,120,121,121,121,121,122,122,122,122,122,123,123
+            ,123,123,123,124,124,124,124,124,124,125,125,125,125,125,125,125
+            ,126,126,126,126,126,126,126,126,126,126,127,127,127,127,127,127
+        };
+
+#endif /* SOFTCLIP512_H_ */
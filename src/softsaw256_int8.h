@@ -0,0 +1,45 @@
+/*
+  softsaw256_int8.h - saw to the 8th harmonic
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0.5 0.33 0.25 0.2 0.17 0.14 0.12
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SOFTSAW256_H_
+#define SOFTSAW256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SOFTSAW256_NUM_CELLS 256
+#define SOFTSAW256_SAMPLERATE 256
+
+/** @ingroup tables
+softsaw256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SOFTSAW256_DATA [256]  =
+        {
+            0,15,29,44,57,70,81,92,101,109,115,120,124,126,127,127
+            ,125,123,120,117,113,108,104,100,95,92,88,85,83,81,79,79
+            ,78,78,79,80,81,82,83,84,85,86,86,86,86,85,85,83
+            ,82,80,78,75,73,71,68,66,64,62,60,59,58,57,56,56
+            ,56,55,56,56,56,56,56,56,56,56,55,55,54,52,51,49
+            ,48,46,44,42,40,38,36,35,33,32,31,30,29,29,28,28
+            ,28,28,28,28,28,28,28,27,26,26,25,23,22,21,19,17
+            ,15,14,12,10,8,7,5,4,3,2,1,1,0,0,0,0
+            ,0,0,0,0,0,-1,-1,-2,-3,-4,-5,-7,-8,-10,-12,-14
+            ,-15,-17,-19,-21,-22,-23,-25,-26,-26,-27,-28,-28,-28,-28,-28,-28
+            ,-28,-28,-28,-29,-29,-30,-31,-32,-33,-35,-36,-38,-40,-42,-44,-46
+            ,-48,-49,-51,-52,-54,-55,-55,-56,-56,-56,-56,-56,-56,-56,-56,-55
+            ,-56,-56,-56,-57,-58,-59,-60,-62,-64,-66,-68,-71,-73,-75,-78,-80
+            ,-82,-83,-85,-85,-86,-86,-86,-86,-85,-84,-83,-82,-81,-80,-79,-78
+            ,-78,-79,-79,-81,-83,-85,-88,-92,-95,-100,-104,-108,-113,-117,-120,-123
+            ,-125,-127,-127,-126,-124,-120,-115,-109,-101,-92,-81,-70,-57,-44,-29,-15
+        };
+
+
+#endif /* SOFTSAW256_H_ */
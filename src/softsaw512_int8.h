@@ -0,0 +1,61 @@
+/*
+  softsaw512_int8.h - saw to the 8th harmonic
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  harmonics 1 0.5 0.33 0.25 0.2 0.17 0.14 0.12
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SOFTSAW512_H_
+#define SOFTSAW512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SOFTSAW512_NUM_CELLS 512
+#define SOFTSAW512_SAMPLERATE 512
+
+/** @ingroup tables
+softsaw512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SOFTSAW512_DATA [512]  =
+        {
+            0,7,15,22,29,37,44,50,57,63,70,76,81,87,92,96
+            ,101,105,109,112,115,118,120,122,124,125,126,127,127,127,127,126
+            ,125,124,123,122,120,118,117,115,113,110,108,106,104,102,100,98
+            ,95,93,92,90,88,87,85,84,83,82,81,80,79,79,79,78
+            ,78,78,78,79,79,79,80,80,81,81,82,82,83,84,84,85
+            ,85,85,86,86,86,86,86,86,86,86,85,85,85,84,83,83
+            ,82,81,80,79,78,77,75,74,73,72,71,70,68,67,66,65
+            ,64,63,62,61,60,60,59,58,58,57,57,56,56,56,56,56
+            ,56,55,55,56,56,56,56,56,56,56,56,56,56,56,56,56
+            ,56,56,56,56,55,55,55,54,54,53,52,52,51,50,49,49
+            ,48,47,46,45,44,43,42,41,40,39,38,37,36,36,35,34
+            ,33,33,32,31,31,30,30,30,29,29,29,29,28,28,28,28
+            ,28,28,28,28,28,28,28,28,28,28,28,28,28,27,27,27
+            ,26,26,26,25,25,24,23,23,22,21,21,20,19,18,17,16
+            ,15,14,14,13,12,11,10,9,8,7,7,6,5,4,4,3
+            ,3,2,2,2,1,1,1,0,0,0,0,0,0,0,0,0
+            ,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-2,-2,-2
+            ,-3,-3,-4,-4,-5,-6,-7,-7,-8,-9,-10,-11,-12,-13,-14,-14
+            ,-15,-16,-17,-18,-19,-20,-21,-21,-22,-23,-23,-24,-25,-25,-26,-26
+            ,-26,-27,-27,-27,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28,-28
+            ,-28,-28,-28,-28,-28,-29,-29,-29,-29,-30,-30,-30,-31,-31,-32,-33
+            ,-33,-34,-35,-36,-36,-37,-38,-39,-40,-41,-42,-43,-44,-45,-46,-47
+            ,-48,-49,-49,-50,-51,-52,-52,-53,-54,-54,-55,-55,-55,-56,-56,-56
+            ,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-56,-55,-55
+            ,-56,-56,-56,-56,-56,-56,-57,-57,-58,-58,-59,-60,-60,-61,-62,-63
+            ,-64,-65,-66,-67,-68,-70,-71,-72,-73,-74,-75,-77,-78,-79,-80,-81
+            ,-82,-83,-83,-84,-85,-85,-85,-86,-86,-86,-86,-86,-86,-86,-86,-85
+            ,-85,-85,-84,-84,-83,-82,-82,-81,-81,-80,-80,-79,-79,-79,-78,-78
+            ,-78,-78,-79,-79,-79,-80,-81,-82,-83,-84,-85,-87,-88,-90,-92,-93
+            ,-95,-98,-100,-102,-104,-106,-108,-110,-113,-115,-117,-118,-120,-122,-123,-124
+            ,-125,-126,-127,-127,-127,-127,-126,-125,-124,-122,-120,-118,-115,-112,-109,-105
+            ,-101,-96,-92,-87,-81,-76,-70,-63,-57,-50,-44,-37,-29,-22,-15,-7
+        };
+
+
+#endif /* SOFTSAW512_H_ */
@@ -1,158 +0,0 @@
-/*
-  SQUARE2018_int8.h - defines a table representing a square waveform
-
-  used for the LFO/carrier/modulator 
-  
-  can be replaced with any values you like, but must be 2048 cells to match the other tables
-*/
-#ifndef SQUARE2048_H_
-#define SQUARE2048_H_
-
-#if ARDUINO >= 100
- #include "Arduino.h"
-#else
- #include "WProgram.h"
-#endif
-#include "mozzi_pgmspace.h"
-
-#define SQUARE2048_NUM_CELLS 2048
-#define SQUARE2048_SAMPLERATE 2048
-
-/** @ingroup tables
-reverse saw table
-*/
-
-CONSTTABLE_STORAGE(int8_t) SQUARE2048_DATA [2048]  =
-        {
-            127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-            ,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128,-128
-        };
-
-
-#endif /* SQUARE2048_H_ */
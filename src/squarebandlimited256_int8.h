@@ -0,0 +1,174 @@
+/*
+  squarebandlimited256_int8.h - band-limited square tables, one per octave
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  bandlimited square 128 8
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SQUAREBANDLIMITED256_H_
+#define SQUAREBANDLIMITED256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SQUAREBANDLIMITED256_NUM_CELLS 256
+#define SQUAREBANDLIMITED256_SAMPLERATE 256
+#define SQUAREBANDLIMITED256_LEVELS 8
+
+/** @ingroup tables
+squarebandlimited256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SQUAREBANDLIMITED256_DATA [8][256]  =
+        {
+          {
+            0,127,97,115,102,112,104,111,105,110,106,110,106,109,106,109
+            ,106,109,106,109,107,109,107,109,107,109,107,109,107,109,107,108
+            ,107,108,107,108,107,108,107,108,107,108,107,108,107,108,107,108
+            ,107,108,107,108,107,108,107,108,107,108,107,108,107,108,107,108
+            ,107,108,107,108,107,108,107,108,107,108,107,108,107,108,107,108
+            ,107,108,107,108,107,108,107,108,107,108,107,108,107,108,107,108
+            ,107,108,107,109,107,109,107,109,107,109,107,109,107,109,106,109
+            ,106,109,106,109,106,110,106,110,105,111,104,112,102,115,97,127
+            ,0,-127,-97,-115,-102,-112,-104,-111,-105,-110,-106,-110,-106,-109,-106,-109
+            ,-106,-109,-106,-109,-107,-109,-107,-109,-107,-109,-107,-109,-107,-109,-107,-108
+            ,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108
+            ,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108
+            ,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108
+            ,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108,-107,-108
+            ,-107,-108,-107,-109,-107,-109,-107,-109,-107,-109,-107,-109,-107,-109,-106,-109
+            ,-106,-109,-106,-109,-106,-110,-106,-110,-105,-111,-104,-112,-102,-115,-97,-127
+          }
+          ,{
+            0,94,127,110,97,107,115,108,102,107,112,108,104,108,111,108
+            ,105,108,110,108,105,108,110,108,106,108,110,108,106,108,109,108
+            ,106,108,109,108,106,108,109,108,106,108,109,108,106,108,109,108
+            ,107,108,109,108,107,108,109,108,107,108,109,108,107,108,109,108
+            ,107,108,109,108,107,108,109,108,107,108,109,108,107,108,109,108
+            ,107,108,109,108,106,108,109,108,106,108,109,108,106,108,109,108
+            ,106,108,109,108,106,108,110,108,106,108,110,108,105,108,110,108
+            ,105,108,111,108,104,108,112,107,102,108,115,107,97,110,127,94
+            ,0,-94,-127,-110,-97,-107,-115,-108,-102,-107,-112,-108,-104,-108,-111,-108
+            ,-105,-108,-110,-108,-105,-108,-110,-108,-106,-108,-110,-108,-106,-108,-109,-108
+            ,-106,-108,-109,-108,-106,-108,-109,-108,-106,-108,-109,-108,-106,-108,-109,-108
+            ,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108
+            ,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108
+            ,-107,-108,-109,-108,-106,-108,-109,-108,-106,-108,-109,-108,-106,-108,-109,-108
+            ,-106,-108,-109,-108,-106,-108,-110,-108,-106,-108,-110,-108,-105,-108,-110,-108
+            ,-105,-108,-111,-108,-104,-108,-112,-107,-102,-108,-115,-107,-97,-110,-127,-94
+          }
+          ,{
+            0,52,94,119,127,121,110,101,97,100,107,113,115,113,108,104
+            ,102,104,107,111,112,111,108,105,104,105,108,110,111,110,108,106
+            ,105,106,108,110,110,110,108,106,105,106,108,109,110,109,108,106
+            ,105,106,108,109,110,109,108,106,106,106,108,109,110,109,108,106
+            ,106,106,108,109,110,109,108,106,106,106,108,109,110,109,108,106
+            ,105,106,108,109,110,109,108,106,105,106,108,110,110,110,108,106
+            ,105,106,108,110,111,110,108,105,104,105,108,111,112,111,107,104
+            ,102,104,108,113,115,113,107,100,97,101,110,121,127,119,94,52
+            ,0,-52,-94,-119,-127,-121,-110,-101,-97,-100,-107,-113,-115,-113,-108,-104
+            ,-102,-104,-107,-111,-112,-111,-108,-105,-104,-105,-108,-110,-111,-110,-108,-106
+            ,-105,-106,-108,-110,-110,-110,-108,-106,-105,-106,-108,-109,-110,-109,-108,-106
+            ,-105,-106,-108,-109,-110,-109,-108,-106,-106,-106,-108,-109,-110,-109,-108,-106
+            ,-106,-106,-108,-109,-110,-109,-108,-106,-106,-106,-108,-109,-110,-109,-108,-106
+            ,-105,-106,-108,-109,-110,-109,-108,-106,-105,-106,-108,-110,-110,-110,-108,-106
+            ,-105,-106,-108,-110,-111,-110,-108,-105,-104,-105,-108,-111,-112,-111,-107,-104
+            ,-102,-104,-108,-113,-115,-113,-107,-100,-97,-101,-110,-121,-127,-119,-94,-52
+          }
+          ,{
+            0,27,52,75,94,109,119,125,127,125,121,116,110,105,100,98
+            ,97,98,100,103,107,110,113,115,115,115,113,111,108,106,103,102
+            ,102,102,103,105,107,109,111,112,113,112,111,110,108,106,104,103
+            ,103,103,104,106,108,109,111,112,112,112,111,109,108,106,105,104
+            ,103,104,105,106,108,109,111,112,112,112,111,109,108,106,104,103
+            ,103,103,104,106,108,110,111,112,113,112,111,109,107,105,103,102
+            ,102,102,103,106,108,111,113,115,115,115,113,110,107,103,100,98
+            ,97,98,100,105,110,116,121,125,127,125,119,109,94,75,52,27
+            ,0,-27,-52,-75,-94,-109,-119,-125,-127,-125,-121,-116,-110,-105,-100,-98
+            ,-97,-98,-100,-103,-107,-110,-113,-115,-115,-115,-113,-111,-108,-106,-103,-102
+            ,-102,-102,-103,-105,-107,-109,-111,-112,-113,-112,-111,-110,-108,-106,-104,-103
+            ,-103,-103,-104,-106,-108,-109,-111,-112,-112,-112,-111,-109,-108,-106,-105,-104
+            ,-103,-104,-105,-106,-108,-109,-111,-112,-112,-112,-111,-109,-108,-106,-104,-103
+            ,-103,-103,-104,-106,-108,-110,-111,-112,-113,-112,-111,-109,-107,-105,-103,-102
+            ,-102,-102,-103,-106,-108,-111,-113,-115,-115,-115,-113,-110,-107,-103,-100,-98
+            ,-97,-98,-100,-105,-110,-116,-121,-125,-127,-125,-119,-109,-94,-75,-52,-27
+          }
+          ,{
+            0,13,27,39,52,64,75,85,94,102,109,115,119,123,125,127
+            ,127,127,125,124,121,119,116,113,110,107,104,101,99,98,97,96
+            ,96,96,97,98,99,101,102,104,106,108,110,112,114,115,116,116
+            ,116,116,116,115,114,112,111,109,107,106,104,103,101,100,99,99
+            ,99,99,99,100,101,103,104,106,107,109,111,112,114,115,116,116
+            ,116,116,116,115,114,112,110,108,106,104,102,101,99,98,97,96
+            ,96,96,97,98,99,101,104,107,110,113,116,119,121,124,125,127
+            ,127,127,125,123,119,115,109,102,94,85,75,64,52,39,27,13
+            ,0,-13,-27,-39,-52,-64,-75,-85,-94,-102,-109,-115,-119,-123,-125,-127
+            ,-127,-127,-125,-124,-121,-119,-116,-113,-110,-107,-104,-101,-99,-98,-97,-96
+            ,-96,-96,-97,-98,-99,-101,-102,-104,-106,-108,-110,-112,-114,-115,-116,-116
+            ,-116,-116,-116,-115,-114,-112,-111,-109,-107,-106,-104,-103,-101,-100,-99,-99
+            ,-99,-99,-99,-100,-101,-103,-104,-106,-107,-109,-111,-112,-114,-115,-116,-116
+            ,-116,-116,-116,-115,-114,-112,-110,-108,-106,-104,-102,-101,-99,-98,-97,-96
+            ,-96,-96,-97,-98,-99,-101,-104,-107,-110,-113,-116,-119,-121,-124,-125,-127
+            ,-127,-127,-125,-123,-119,-115,-109,-102,-94,-85,-75,-64,-52,-39,-27,-13
+          }
+          ,{
+            0,7,13,20,26,33,39,45,51,57,63,68,74,79,84,89
+            ,93,97,101,105,108,111,114,117,119,121,123,124,125,126,127,127
+            ,127,127,127,126,125,124,123,122,121,119,118,116,114,113,111,109
+            ,107,105,104,102,100,99,97,96,95,94,93,92,91,91,90,90
+            ,90,90,90,91,91,92,93,94,95,96,97,99,100,102,104,105
+            ,107,109,111,113,114,116,118,119,121,122,123,124,125,126,127,127
+            ,127,127,127,126,125,124,123,121,119,117,114,111,108,105,101,97
+            ,93,89,84,79,74,68,63,57,51,45,39,33,26,20,13,7
+            ,0,-7,-13,-20,-26,-33,-39,-45,-51,-57,-63,-68,-74,-79,-84,-89
+            ,-93,-97,-101,-105,-108,-111,-114,-117,-119,-121,-123,-124,-125,-126,-127,-127
+            ,-127,-127,-127,-126,-125,-124,-123,-122,-121,-119,-118,-116,-114,-113,-111,-109
+            ,-107,-105,-104,-102,-100,-99,-97,-96,-95,-94,-93,-92,-91,-91,-90,-90
+            ,-90,-90,-90,-91,-91,-92,-93,-94,-95,-96,-97,-99,-100,-102,-104,-105
+            ,-107,-109,-111,-113,-114,-116,-118,-119,-121,-122,-123,-124,-125,-126,-127,-127
+            ,-127,-127,-127,-126,-125,-124,-123,-121,-119,-117,-114,-111,-108,-105,-101,-97
+            ,-93,-89,-84,-79,-74,-68,-63,-57,-51,-45,-39,-33,-26,-20,-13,-7
+          }
+          ,{
+            0,3,6,9,12,16,19,22,25,28,31,34,37,40,43,46
+            ,49,51,54,57,60,63,65,68,71,73,76,78,81,83,85,88
+            ,90,92,94,96,98,100,102,104,106,107,109,111,112,113,115,116
+            ,117,118,120,121,122,122,123,124,125,125,126,126,126,127,127,127
+            ,127,127,127,127,126,126,126,125,125,124,123,122,122,121,120,118
+            ,117,116,115,113,112,111,109,107,106,104,102,100,98,96,94,92
+            ,90,88,85,83,81,78,76,73,71,68,65,63,60,57,54,51
+            ,49,46,43,40,37,34,31,28,25,22,19,16,12,9,6,3
+            ,0,-3,-6,-9,-12,-16,-19,-22,-25,-28,-31,-34,-37,-40,-43,-46
+            ,-49,-51,-54,-57,-60,-63,-65,-68,-71,-73,-76,-78,-81,-83,-85,-88
+            ,-90,-92,-94,-96,-98,-100,-102,-104,-106,-107,-109,-111,-112,-113,-115,-116
+            ,-117,-118,-120,-121,-122,-122,-123,-124,-125,-125,-126,-126,-126,-127,-127,-127
+            ,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-123,-122,-122,-121,-120,-118
+            ,-117,-116,-115,-113,-112,-111,-109,-107,-106,-104,-102,-100,-98,-96,-94,-92
+            ,-90,-88,-85,-83,-81,-78,-76,-73,-71,-68,-65,-63,-60,-57,-54,-51
+            ,-49,-46,-43,-40,-37,-34,-31,-28,-25,-22,-19,-16,-12,-9,-6,-3
+          }
+          ,{
+            0,3,6,9,12,16,19,22,25,28,31,34,37,40,43,46
+            ,49,51,54,57,60,63,65,68,71,73,76,78,81,83,85,88
+            ,90,92,94,96,98,100,102,104,106,107,109,111,112,113,115,116
+            ,117,118,120,121,122,122,123,124,125,125,126,126,126,127,127,127
+            ,127,127,127,127,126,126,126,125,125,124,123,122,122,121,120,118
+            ,117,116,115,113,112,111,109,107,106,104,102,100,98,96,94,92
+            ,90,88,85,83,81,78,76,73,71,68,65,63,60,57,54,51
+            ,49,46,43,40,37,34,31,28,25,22,19,16,12,9,6,3
+            ,0,-3,-6,-9,-12,-16,-19,-22,-25,-28,-31,-34,-37,-40,-43,-46
+            ,-49,-51,-54,-57,-60,-63,-65,-68,-71,-73,-76,-78,-81,-83,-85,-88
+            ,-90,-92,-94,-96,-98,-100,-102,-104,-106,-107,-109,-111,-112,-113,-115,-116
+            ,-117,-118,-120,-121,-122,-122,-123,-124,-125,-125,-126,-126,-126,-127,-127,-127
+            ,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-123,-122,-122,-121,-120,-118
+            ,-117,-116,-115,-113,-112,-111,-109,-107,-106,-104,-102,-100,-98,-96,-94,-92
+            ,-90,-88,-85,-83,-81,-78,-76,-73,-71,-68,-65,-63,-60,-57,-54,-51
+            ,-49,-46,-43,-40,-37,-34,-31,-28,-25,-22,-19,-16,-12,-9,-6,-3
+          }
+        };
+
+
+#endif /* SQUAREBANDLIMITED256_H_ */
@@ -0,0 +1,302 @@
+/*
+  squarebandlimited512_int8.h - band-limited square tables, one per octave
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  bandlimited square 128 8
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef SQUAREBANDLIMITED512_H_
+#define SQUAREBANDLIMITED512_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define SQUAREBANDLIMITED512_NUM_CELLS 512
+#define SQUAREBANDLIMITED512_SAMPLERATE 512
+#define SQUAREBANDLIMITED512_LEVELS 8
+
+/** @ingroup tables
+squarebandlimited512 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) SQUAREBANDLIMITED512_DATA [8][512]  =
+        {
+          {
+            0,94,127,110,97,107,115,108,102,107,112,108,104,108,111,108
+            ,105,108,110,108,106,108,110,108,106,108,109,108,106,108,109,108
+            ,106,108,109,108,106,108,109,108,107,108,109,108,107,108,109,108
+            ,107,108,109,108,107,108,109,108,107,108,109,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,108,108,107,108,108,108,107,108,108,108
+            ,107,108,108,108,107,108,109,108,107,108,109,108,107,108,109,108
+            ,107,108,109,108,107,108,109,108,107,108,109,108,106,108,109,108
+            ,106,108,109,108,106,108,109,108,106,108,110,108,106,108,110,108
+            ,105,108,111,108,104,108,112,107,102,108,115,107,97,110,127,94
+            ,0,-94,-127,-110,-97,-107,-115,-108,-102,-107,-112,-108,-104,-108,-111,-108
+            ,-105,-108,-110,-108,-106,-108,-110,-108,-106,-108,-109,-108,-106,-108,-109,-108
+            ,-106,-108,-109,-108,-106,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108
+            ,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108,-107,-108,-108,-108
+            ,-107,-108,-108,-108,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108
+            ,-107,-108,-109,-108,-107,-108,-109,-108,-107,-108,-109,-108,-106,-108,-109,-108
+            ,-106,-108,-109,-108,-106,-108,-109,-108,-106,-108,-110,-108,-106,-108,-110,-108
+            ,-105,-108,-111,-108,-104,-108,-112,-107,-102,-108,-115,-107,-97,-110,-127,-94
+          }
+          ,{
+            0,52,94,119,127,121,110,101,97,100,107,113,115,113,108,104
+            ,102,104,107,111,112,111,108,105,104,105,108,110,111,110,108,106
+            ,105,106,108,109,110,109,108,106,105,106,108,109,110,109,108,106
+            ,106,106,108,109,110,109,108,107,106,107,108,109,109,109,108,107
+            ,106,107,108,109,109,109,108,107,106,107,108,109,109,109,108,107
+            ,106,107,108,109,109,109,108,107,106,107,108,109,109,109,108,107
+            ,107,107,108,109,109,109,108,107,107,107,108,108,109,108,108,107
+            ,107,107,108,108,109,108,108,107,107,107,108,108,109,108,108,107
+            ,107,107,108,108,109,108,108,107,107,107,108,108,109,108,108,107
+            ,107,107,108,108,109,108,108,107,107,107,108,109,109,109,108,107
+            ,107,107,108,109,109,109,108,107,106,107,108,109,109,109,108,107
+            ,106,107,108,109,109,109,108,107,106,107,108,109,109,109,108,107
+            ,106,107,108,109,109,109,108,107,106,107,108,109,110,109,108,106
+            ,106,106,108,109,110,109,108,106,105,106,108,109,110,109,108,106
+            ,105,106,108,110,111,110,108,105,104,105,108,111,112,111,107,104
+            ,102,104,108,113,115,113,107,100,97,101,110,121,127,119,94,52
+            ,0,-52,-94,-119,-127,-121,-110,-101,-97,-100,-107,-113,-115,-113,-108,-104
+            ,-102,-104,-107,-111,-112,-111,-108,-105,-104,-105,-108,-110,-111,-110,-108,-106
+            ,-105,-106,-108,-109,-110,-109,-108,-106,-105,-106,-108,-109,-110,-109,-108,-106
+            ,-106,-106,-108,-109,-110,-109,-108,-107,-106,-107,-108,-109,-109,-109,-108,-107
+            ,-106,-107,-108,-109,-109,-109,-108,-107,-106,-107,-108,-109,-109,-109,-108,-107
+            ,-106,-107,-108,-109,-109,-109,-108,-107,-106,-107,-108,-109,-109,-109,-108,-107
+            ,-107,-107,-108,-109,-109,-109,-108,-107,-107,-107,-108,-108,-109,-108,-108,-107
+            ,-107,-107,-108,-108,-109,-108,-108,-107,-107,-107,-108,-108,-109,-108,-108,-107
+            ,-107,-107,-108,-108,-109,-108,-108,-107,-107,-107,-108,-108,-109,-108,-108,-107
+            ,-107,-107,-108,-108,-109,-108,-108,-107,-107,-107,-108,-109,-109,-109,-108,-107
+            ,-107,-107,-108,-109,-109,-109,-108,-107,-106,-107,-108,-109,-109,-109,-108,-107
+            ,-106,-107,-108,-109,-109,-109,-108,-107,-106,-107,-108,-109,-109,-109,-108,-107
+            ,-106,-107,-108,-109,-109,-109,-108,-107,-106,-107,-108,-109,-110,-109,-108,-106
+            ,-106,-106,-108,-109,-110,-109,-108,-106,-105,-106,-108,-109,-110,-109,-108,-106
+            ,-105,-106,-108,-110,-111,-110,-108,-105,-104,-105,-108,-111,-112,-111,-107,-104
+            ,-102,-104,-108,-113,-115,-113,-107,-100,-97,-101,-110,-121,-127,-119,-94,-52
+          }
+          ,{
+            0,27,52,75,94,109,119,125,127,125,121,116,110,105,101,98
+            ,97,98,100,103,107,110,113,114,115,114,113,111,108,106,104,103
+            ,102,103,104,105,107,109,111,112,112,112,111,110,108,106,105,104
+            ,104,104,105,106,108,109,110,111,111,111,110,109,108,107,106,105
+            ,105,105,106,106,108,109,110,110,110,110,110,109,108,107,106,105
+            ,105,105,106,107,108,109,109,110,110,110,109,109,108,107,106,106
+            ,105,106,106,107,108,109,109,110,110,110,109,109,108,107,106,106
+            ,106,106,106,107,108,109,109,110,110,110,109,109,108,107,106,106
+            ,106,106,106,107,108,109,109,110,110,110,109,109,108,107,106,106
+            ,106,106,106,107,108,109,109,110,110,110,109,109,108,107,106,106
+            ,105,106,106,107,108,109,109,110,110,110,109,109,108,107,106,105
+            ,105,105,106,107,108,109,110,110,110,110,110,109,108,106,106,105
+            ,105,105,106,107,108,109,110,111,111,111,110,109,108,106,105,104
+            ,104,104,105,106,108,110,111,112,112,112,111,109,107,105,104,103
+            ,102,103,104,106,108,111,113,114,115,114,113,110,107,103,100,98
+            ,97,98,101,105,110,116,121,125,127,125,119,109,94,75,52,27
+            ,0,-27,-52,-75,-94,-109,-119,-125,-127,-125,-121,-116,-110,-105,-101,-98
+            ,-97,-98,-100,-103,-107,-110,-113,-114,-115,-114,-113,-111,-108,-106,-104,-103
+            ,-102,-103,-104,-105,-107,-109,-111,-112,-112,-112,-111,-110,-108,-106,-105,-104
+            ,-104,-104,-105,-106,-108,-109,-110,-111,-111,-111,-110,-109,-108,-107,-106,-105
+            ,-105,-105,-106,-106,-108,-109,-110,-110,-110,-110,-110,-109,-108,-107,-106,-105
+            ,-105,-105,-106,-107,-108,-109,-109,-110,-110,-110,-109,-109,-108,-107,-106,-106
+            ,-105,-106,-106,-107,-108,-109,-109,-110,-110,-110,-109,-109,-108,-107,-106,-106
+            ,-106,-106,-106,-107,-108,-109,-109,-110,-110,-110,-109,-109,-108,-107,-106,-106
+            ,-106,-106,-106,-107,-108,-109,-109,-110,-110,-110,-109,-109,-108,-107,-106,-106
+            ,-106,-106,-106,-107,-108,-109,-109,-110,-110,-110,-109,-109,-108,-107,-106,-106
+            ,-105,-106,-106,-107,-108,-109,-109,-110,-110,-110,-109,-109,-108,-107,-106,-105
+            ,-105,-105,-106,-107,-108,-109,-110,-110,-110,-110,-110,-109,-108,-106,-106,-105
+            ,-105,-105,-106,-107,-108,-109,-110,-111,-111,-111,-110,-109,-108,-106,-105,-104
+            ,-104,-104,-105,-106,-108,-110,-111,-112,-112,-112,-111,-109,-107,-105,-104,-103
+            ,-102,-103,-104,-106,-108,-111,-113,-114,-115,-114,-113,-110,-107,-103,-100,-98
+            ,-97,-98,-101,-105,-110,-116,-121,-125,-127,-125,-119,-109,-94,-75,-52,-27
+          }
+          ,{
+            0,13,27,40,52,64,75,85,94,102,109,115,119,123,125,127
+            ,127,127,125,124,121,119,116,113,110,107,105,102,100,99,98,97
+            ,97,97,98,99,100,101,103,105,107,108,110,112,113,114,115,115
+            ,115,115,115,114,113,112,111,109,108,107,106,104,103,103,102,102
+            ,102,102,102,103,103,104,105,106,107,108,109,110,111,112,112,113
+            ,113,113,112,112,111,110,110,109,108,107,106,105,104,104,103,103
+            ,103,103,103,104,104,105,106,107,108,108,109,110,111,111,112,112
+            ,112,112,112,111,111,110,109,108,108,107,106,105,105,104,104,103
+            ,103,103,104,104,105,105,106,107,108,108,109,110,111,111,112,112
+            ,112,112,112,111,111,110,109,108,108,107,106,105,104,104,103,103
+            ,103,103,103,104,104,105,106,107,108,109,110,110,111,112,112,113
+            ,113,113,112,112,111,110,109,108,107,106,105,104,103,103,102,102
+            ,102,102,102,103,103,104,106,107,108,109,111,112,113,114,115,115
+            ,115,115,115,114,113,112,110,108,107,105,103,101,100,99,98,97
+            ,97,97,98,99,100,102,105,107,110,113,116,119,121,124,125,127
+            ,127,127,125,123,119,115,109,102,94,85,75,64,52,40,27,13
+            ,0,-13,-27,-40,-52,-64,-75,-85,-94,-102,-109,-115,-119,-123,-125,-127
+            ,-127,-127,-125,-124,-121,-119,-116,-113,-110,-107,-105,-102,-100,-99,-98,-97
+            ,-97,-97,-98,-99,-100,-101,-103,-105,-107,-108,-110,-112,-113,-114,-115,-115
+            ,-115,-115,-115,-114,-113,-112,-111,-109,-108,-107,-106,-104,-103,-103,-102,-102
+            ,-102,-102,-102,-103,-103,-104,-105,-106,-107,-108,-109,-110,-111,-112,-112,-113
+            ,-113,-113,-112,-112,-111,-110,-110,-109,-108,-107,-106,-105,-104,-104,-103,-103
+            ,-103,-103,-103,-104,-104,-105,-106,-107,-108,-108,-109,-110,-111,-111,-112,-112
+            ,-112,-112,-112,-111,-111,-110,-109,-108,-108,-107,-106,-105,-105,-104,-104,-103
+            ,-103,-103,-104,-104,-105,-105,-106,-107,-108,-108,-109,-110,-111,-111,-112,-112
+            ,-112,-112,-112,-111,-111,-110,-109,-108,-108,-107,-106,-105,-104,-104,-103,-103
+            ,-103,-103,-103,-104,-104,-105,-106,-107,-108,-109,-110,-110,-111,-112,-112,-113
+            ,-113,-113,-112,-112,-111,-110,-109,-108,-107,-106,-105,-104,-103,-103,-102,-102
+            ,-102,-102,-102,-103,-103,-104,-106,-107,-108,-109,-111,-112,-113,-114,-115,-115
+            ,-115,-115,-115,-114,-113,-112,-110,-108,-107,-105,-103,-101,-100,-99,-98,-97
+            ,-97,-97,-98,-99,-100,-102,-105,-107,-110,-113,-116,-119,-121,-124,-125,-127
+            ,-127,-127,-125,-123,-119,-115,-109,-102,-94,-85,-75,-64,-52,-40,-27,-13
+          }
+          ,{
+            0,7,13,20,27,33,39,46,52,58,64,69,75,80,85,89
+            ,94,98,102,105,109,112,115,117,119,121,123,124,125,126,127,127
+            ,127,127,127,126,125,125,124,123,121,120,119,117,116,114,113,111
+            ,110,108,107,105,104,103,101,100,99,99,98,97,97,96,96,96
+            ,96,96,96,96,97,97,98,98,99,100,101,102,102,103,104,105
+            ,106,107,108,109,110,111,112,113,114,114,115,115,116,116,116,116
+            ,116,116,116,116,116,115,115,114,114,113,112,112,111,110,109,108
+            ,107,107,106,105,104,103,103,102,101,101,100,100,99,99,99,99
+            ,99,99,99,99,99,100,100,101,101,102,103,103,104,105,106,107
+            ,107,108,109,110,111,112,112,113,114,114,115,115,116,116,116,116
+            ,116,116,116,116,116,115,115,114,114,113,112,111,110,109,108,107
+            ,106,105,104,103,102,102,101,100,99,98,98,97,97,96,96,96
+            ,96,96,96,96,97,97,98,99,99,100,101,103,104,105,107,108
+            ,110,111,113,114,116,117,119,120,121,123,124,125,125,126,127,127
+            ,127,127,127,126,125,124,123,121,119,117,115,112,109,105,102,98
+            ,94,89,85,80,75,69,64,58,52,46,39,33,27,20,13,7
+            ,0,-7,-13,-20,-27,-33,-39,-46,-52,-58,-64,-69,-75,-80,-85,-89
+            ,-94,-98,-102,-105,-109,-112,-115,-117,-119,-121,-123,-124,-125,-126,-127,-127
+            ,-127,-127,-127,-126,-125,-125,-124,-123,-121,-120,-119,-117,-116,-114,-113,-111
+            ,-110,-108,-107,-105,-104,-103,-101,-100,-99,-99,-98,-97,-97,-96,-96,-96
+            ,-96,-96,-96,-96,-97,-97,-98,-98,-99,-100,-101,-102,-102,-103,-104,-105
+            ,-106,-107,-108,-109,-110,-111,-112,-113,-114,-114,-115,-115,-116,-116,-116,-116
+            ,-116,-116,-116,-116,-116,-115,-115,-114,-114,-113,-112,-112,-111,-110,-109,-108
+            ,-107,-107,-106,-105,-104,-103,-103,-102,-101,-101,-100,-100,-99,-99,-99,-99
+            ,-99,-99,-99,-99,-99,-100,-100,-101,-101,-102,-103,-103,-104,-105,-106,-107
+            ,-107,-108,-109,-110,-111,-112,-112,-113,-114,-114,-115,-115,-116,-116,-116,-116
+            ,-116,-116,-116,-116,-116,-115,-115,-114,-114,-113,-112,-111,-110,-109,-108,-107
+            ,-106,-105,-104,-103,-102,-102,-101,-100,-99,-98,-98,-97,-97,-96,-96,-96
+            ,-96,-96,-96,-96,-97,-97,-98,-99,-99,-100,-101,-103,-104,-105,-107,-108
+            ,-110,-111,-113,-114,-116,-117,-119,-120,-121,-123,-124,-125,-125,-126,-127,-127
+            ,-127,-127,-127,-126,-125,-124,-123,-121,-119,-117,-115,-112,-109,-105,-102,-98
+            ,-94,-89,-85,-80,-75,-69,-64,-58,-52,-46,-39,-33,-27,-20,-13,-7
+          }
+          ,{
+            0,3,7,10,13,16,20,23,26,29,33,36,39,42,45,48
+            ,51,54,57,60,63,66,68,71,74,76,79,81,84,86,89,91
+            ,93,95,97,99,101,103,105,107,108,110,111,113,114,115,117,118
+            ,119,120,121,122,123,123,124,125,125,126,126,126,127,127,127,127
+            ,127,127,127,127,127,126,126,126,125,125,124,124,123,123,122,121
+            ,121,120,119,119,118,117,116,115,114,114,113,112,111,110,109,108
+            ,107,106,105,105,104,103,102,101,100,100,99,98,97,97,96,95
+            ,95,94,94,93,93,92,92,91,91,91,91,90,90,90,90,90
+            ,90,90,90,90,90,90,91,91,91,91,92,92,93,93,94,94
+            ,95,95,96,97,97,98,99,100,100,101,102,103,104,105,105,106
+            ,107,108,109,110,111,112,113,114,114,115,116,117,118,119,119,120
+            ,121,121,122,123,123,124,124,125,125,126,126,126,127,127,127,127
+            ,127,127,127,127,127,126,126,126,125,125,124,123,123,122,121,120
+            ,119,118,117,115,114,113,111,110,108,107,105,103,101,99,97,95
+            ,93,91,89,86,84,81,79,76,74,71,68,66,63,60,57,54
+            ,51,48,45,42,39,36,33,29,26,23,20,16,13,10,7,3
+            ,0,-3,-7,-10,-13,-16,-20,-23,-26,-29,-33,-36,-39,-42,-45,-48
+            ,-51,-54,-57,-60,-63,-66,-68,-71,-74,-76,-79,-81,-84,-86,-89,-91
+            ,-93,-95,-97,-99,-101,-103,-105,-107,-108,-110,-111,-113,-114,-115,-117,-118
+            ,-119,-120,-121,-122,-123,-123,-124,-125,-125,-126,-126,-126,-127,-127,-127,-127
+            ,-127,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-124,-123,-123,-122,-121
+            ,-121,-120,-119,-119,-118,-117,-116,-115,-114,-114,-113,-112,-111,-110,-109,-108
+            ,-107,-106,-105,-105,-104,-103,-102,-101,-100,-100,-99,-98,-97,-97,-96,-95
+            ,-95,-94,-94,-93,-93,-92,-92,-91,-91,-91,-91,-90,-90,-90,-90,-90
+            ,-90,-90,-90,-90,-90,-90,-91,-91,-91,-91,-92,-92,-93,-93,-94,-94
+            ,-95,-95,-96,-97,-97,-98,-99,-100,-100,-101,-102,-103,-104,-105,-105,-106
+            ,-107,-108,-109,-110,-111,-112,-113,-114,-114,-115,-116,-117,-118,-119,-119,-120
+            ,-121,-121,-122,-123,-123,-124,-124,-125,-125,-126,-126,-126,-127,-127,-127,-127
+            ,-127,-127,-127,-127,-127,-126,-126,-126,-125,-125,-124,-123,-123,-122,-121,-120
+            ,-119,-118,-117,-115,-114,-113,-111,-110,-108,-107,-105,-103,-101,-99,-97,-95
+            ,-93,-91,-89,-86,-84,-81,-79,-76,-74,-71,-68,-66,-63,-60,-57,-54
+            ,-51,-48,-45,-42,-39,-36,-33,-29,-26,-23,-20,-16,-13,-10,-7,-3
+          }
+          ,{
+            0,2,3,5,6,8,9,11,12,14,16,17,19,20,22,23
+            ,25,26,28,29,31,32,34,35,37,38,40,41,43,44,46,47
+            ,49,50,51,53,54,56,57,58,60,61,63,64,65,67,68,69
+            ,71,72,73,74,76,77,78,79,81,82,83,84,85,86,88,89
+            ,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105
+            ,106,106,107,108,109,110,111,111,112,113,113,114,115,115,116,117
+            ,117,118,118,119,120,120,121,121,122,122,122,123,123,124,124,124
+            ,125,125,125,125,126,126,126,126,126,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,126,126,126,126,126,125,125,125
+            ,125,124,124,124,123,123,122,122,122,121,121,120,120,119,118,118
+            ,117,117,116,115,115,114,113,113,112,111,111,110,109,108,107,106
+            ,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91
+            ,90,89,88,86,85,84,83,82,81,79,78,77,76,74,73,72
+            ,71,69,68,67,65,64,63,61,60,58,57,56,54,53,51,50
+            ,49,47,46,44,43,41,40,38,37,35,34,32,31,29,28,26
+            ,25,23,22,20,19,17,16,14,12,11,9,8,6,5,3,2
+            ,0,-2,-3,-5,-6,-8,-9,-11,-12,-14,-16,-17,-19,-20,-22,-23
+            ,-25,-26,-28,-29,-31,-32,-34,-35,-37,-38,-40,-41,-43,-44,-46,-47
+            ,-49,-50,-51,-53,-54,-56,-57,-58,-60,-61,-63,-64,-65,-67,-68,-69
+            ,-71,-72,-73,-74,-76,-77,-78,-79,-81,-82,-83,-84,-85,-86,-88,-89
+            ,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105
+            ,-106,-106,-107,-108,-109,-110,-111,-111,-112,-113,-113,-114,-115,-115,-116,-117
+            ,-117,-118,-118,-119,-120,-120,-121,-121,-122,-122,-122,-123,-123,-124,-124,-124
+            ,-125,-125,-125,-125,-126,-126,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127
+            ,-127,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-126,-126,-125,-125,-125
+            ,-125,-124,-124,-124,-123,-123,-122,-122,-122,-121,-121,-120,-120,-119,-118,-118
+            ,-117,-117,-116,-115,-115,-114,-113,-113,-112,-111,-111,-110,-109,-108,-107,-106
+            ,-106,-105,-104,-103,-102,-101,-100,-99,-98,-97,-96,-95,-94,-93,-92,-91
+            ,-90,-89,-88,-86,-85,-84,-83,-82,-81,-79,-78,-77,-76,-74,-73,-72
+            ,-71,-69,-68,-67,-65,-64,-63,-61,-60,-58,-57,-56,-54,-53,-51,-50
+            ,-49,-47,-46,-44,-43,-41,-40,-38,-37,-35,-34,-32,-31,-29,-28,-26
+            ,-25,-23,-22,-20,-19,-17,-16,-14,-12,-11,-9,-8,-6,-5,-3,-2
+          }
+          ,{
+            0,2,3,5,6,8,9,11,12,14,16,17,19,20,22,23
+            ,25,26,28,29,31,32,34,35,37,38,40,41,43,44,46,47
+            ,49,50,51,53,54,56,57,58,60,61,63,64,65,67,68,69
+            ,71,72,73,74,76,77,78,79,81,82,83,84,85,86,88,89
+            ,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105
+            ,106,106,107,108,109,110,111,111,112,113,113,114,115,115,116,117
+            ,117,118,118,119,120,120,121,121,122,122,122,123,123,124,124,124
+            ,125,125,125,125,126,126,126,126,126,127,127,127,127,127,127,127
+            ,127,127,127,127,127,127,127,127,126,126,126,126,126,125,125,125
+            ,125,124,124,124,123,123,122,122,122,121,121,120,120,119,118,118
+            ,117,117,116,115,115,114,113,113,112,111,111,110,109,108,107,106
+            ,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91
+            ,90,89,88,86,85,84,83,82,81,79,78,77,76,74,73,72
+            ,71,69,68,67,65,64,63,61,60,58,57,56,54,53,51,50
+            ,49,47,46,44,43,41,40,38,37,35,34,32,31,29,28,26
+            ,25,23,22,20,19,17,16,14,12,11,9,8,6,5,3,2
+            ,0,-2,-3,-5,-6,-8,-9,-11,-12,-14,-16,-17,-19,-20,-22,-23
+            ,-25,-26,-28,-29,-31,-32,-34,-35,-37,-38,-40,-41,-43,-44,-46,-47
+            ,-49,-50,-51,-53,-54,-56,-57,-58,-60,-61,-63,-64,-65,-67,-68,-69
+            ,-71,-72,-73,-74,-76,-77,-78,-79,-81,-82,-83,-84,-85,-86,-88,-89
+            ,-90,-91,-92,-93,-94,-95,-96,-97,-98,-99,-100,-101,-102,-103,-104,-105
+            ,-106,-106,-107,-108,-109,-110,-111,-111,-112,-113,-113,-114,-115,-115,-116,-117
+            ,-117,-118,-118,-119,-120,-120,-121,-121,-122,-122,-122,-123,-123,-124,-124,-124
+            ,-125,-125,-125,-125,-126,-126,-126,-126,-126,-127,-127,-127,-127,-127,-127,-127
+            ,-127,-127,-127,-127,-127,-127,-127,-127,-126,-126,-126,-126,-126,-125,-125,-125
+            ,-125,-124,-124,-124,-123,-123,-122,-122,-122,-121,-121,-120,-120,-119,-118,-118
+            ,-117,-117,-116,-115,-115,-114,-113,-113,-112,-111,-111,-110,-109,-108,-107,-106
+            ,-106,-105,-104,-103,-102,-101,-100,-99,-98,-97,-96,-95,-94,-93,-92,-91
+            ,-90,-89,-88,-86,-85,-84,-83,-82,-81,-79,-78,-77,-76,-74,-73,-72
+            ,-71,-69,-68,-67,-65,-64,-63,-61,-60,-58,-57,-56,-54,-53,-51,-50
+            ,-49,-47,-46,-44,-43,-41,-40,-38,-37,-35,-34,-32,-31,-29,-28,-26
+            ,-25,-23,-22,-20,-19,-17,-16,-14,-12,-11,-9,-8,-6,-5,-3,-2
+          }
+        };
+
+
+#endif /* SQUAREBANDLIMITED512_H_ */
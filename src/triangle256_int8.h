@@ -0,0 +1,45 @@
+/*
+  triangle256_int8.h - triangle
+
+  generated by host/wavetableGen.cpp from host/wavetables/wavetables.txt:  formula triangle
+  edit the spec & regenerate rather than editing this file
+*/
+#ifndef TRIANGLE256_H_
+#define TRIANGLE256_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define TRIANGLE256_NUM_CELLS 256
+#define TRIANGLE256_SAMPLERATE 256
+
+/** @ingroup tables
+triangle256 table
+*/
+
+CONSTTABLE_STORAGE(int8_t) TRIANGLE256_DATA [256]  =
+        {
+            -127,-126,-124,-122,-120,-118,-116,-114,-112,-110,-108,-106,-104,-102,-100,-98
+            ,-96,-94,-92,-90,-88,-86,-84,-82,-80,-78,-76,-74,-72,-70,-68,-66
+            ,-64,-62,-60,-58,-56,-54,-52,-50,-48,-46,-44,-42,-40,-38,-36,-34
+            ,-32,-30,-28,-26,-24,-22,-20,-18,-16,-14,-12,-10,-8,-6,-4,-2
+            ,0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30
+            ,32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,62
+            ,64,66,68,70,72,74,76,78,80,82,84,86,88,90,92,94
+            ,96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126
+            ,127,126,124,122,120,118,116,114,112,110,108,106,104,102,100,98
+            ,96,94,92,90,88,86,84,82,80,78,76,74,72,70,68,66
+            ,64,62,60,58,56,54,52,50,48,46,44,42,40,38,36,34
+            ,32,30,28,26,24,22,20,18,16,14,12,10,8,6,4,2
+            ,0,-2,-4,-6,-8,-10,-12,-14,-16,-18,-20,-22,-24,-26,-28,-30
+            ,-32,-34,-36,-38,-40,-42,-44,-46,-48,-50,-52,-54,-56,-58,-60,-62
+            ,-64,-66,-68,-70,-72,-74,-76,-78,-80,-82,-84,-86,-88,-90,-92,-94
+            ,-96,-98,-100,-102,-104,-106,-108,-110,-112,-114,-116,-118,-120,-122,-124,-126
+        };
+
+
+#endif /* TRIANGLE256_H_ */
@@ -0,0 +1,58 @@
+/*----------------------------------------------------------------------------------------------------------
+ * tuning.h
+ * 
+ * Selects the tuning used by MutatingFM::setFreqs() and the sequencer's scales.  Equal temperament unless
+ * TUNING_HEADER in MutantFMSynthOptions.h names a table made by host/sclToHeader.cpp
+ * 
+ * every tuning defines:
+ *    TUNING_NUM_CELLS          number of notes in the table
+ *    TUNING_NOTES_PER_OCTAVE   number of notes in the tuning's period - usually an octave
+ *    TUNING_PHASEINC_DATA      carrier phase increment for each note
+ *    TUNING_AUDIO_RATE         AUDIO_RATE & wavetable size the phase increments are for
+ *    TUNING_TABLE_CELLS
+ * and tunings other than equal temperament define
+ *    TUNING_SEMITONE_STEPS     the nearest note of the tuning to each equal tempered semitone 0-11
+ * 
+ * Source Code Repository:  https://github.com/Meebleeps/MeeBleeps-Freaq-FM-Synth
+ * Youtube Channel:         https://www.youtube.com/channel/UC4I1ExnOpH_GjNtm7ZdWeWA
+ * 
+ * (C) 2021-2022 Meebleeps
+*-----------------------------------------------------------------------------------------------------------
+*/
+#ifndef tuning_h
+#define tuning_h
+
+#include "Arduino.h"
+#include "MutantFMSynthOptions.h"
+
+#ifdef TUNING_HEADER
+#include TUNING_HEADER
+#else
+#include "midinotephaseinc_uint32.h" // equal temperament
+
+#define TUNING_NUM_CELLS          MIDINOTE_PHASEINC_NUM_CELLS
+#define TUNING_NOTES_PER_OCTAVE   12
+#define TUNING_PHASEINC_DATA      MIDINOTE_PHASEINC_DATA
+#define TUNING_AUDIO_RATE         MIDINOTE_PHASEINC_AUDIO_RATE
+#define TUNING_TABLE_CELLS        MIDINOTE_PHASEINC_TABLE_CELLS
+#endif
+
+
+/*----------------------------------------------------------------------------------------------------------
+ * semitonesToTuningSteps
+ * converts an interval in equal tempered semitones (-120 to 127) to the nearest interval in notes of the tuning
+ * used when a scale is set up, so playing a note costs the same in every tuning
+ *----------------------------------------------------------------------------------------------------------
+ */
+inline int16_t semitonesToTuningSteps(int8_t semitones)
+{
+  #ifdef TUNING_SEMITONE_STEPS
+  int8_t octaves = ((int16_t)semitones + 120) / 12 - 10;
+
+  return (int16_t)octaves * TUNING_NOTES_PER_OCTAVE + FLASH_OR_RAM_READ<const uint8_t>(TUNING_SEMITONE_STEPS + (semitones - octaves * 12));
+  #else
+  return semitones;
+  #endif
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+  tuning_19edo_uint32.h - defines the 19edo tuning for MutatingFM::setFreqs() and the sequencer's scales
+
+  19 equal divisions of the octave
+
+  generated by host/sclToHeader.cpp from host/tunings/19edo.scl - regenerate rather than editing
+  19 notes per period.  to use it, #define TUNING_HEADER "tuning_19edo_uint32.h" in MutantFMSynthOptions.h
+*/
+#ifndef TUNING_19EDO_UINT32_H_
+#define TUNING_19EDO_UINT32_H_
+
+#if ARDUINO >= 100
+ #include "Arduino.h"
+#else
+ #include "WProgram.h"
+#endif
+#include "mozzi_pgmspace.h"
+
+#define TUNING_19EDO_NUM_CELLS 256
+#define TUNING_19EDO_NOTES_PER_OCTAVE 19
+
+// names used by tuning.h
+#define TUNING_NUM_CELLS          TUNING_19EDO_NUM_CELLS
+#define TUNING_NOTES_PER_OCTAVE   TUNING_19EDO_NOTES_PER_OCTAVE
+#define TUNING_PHASEINC_DATA      TUNING_19EDO_DATA
+#define TUNING_SEMITONE_STEPS     TUNING_19EDO_SEMITONE_STEPS
+#define TUNING_AUDIO_RATE         16384
+#define TUNING_TABLE_CELLS        2048
+
+/** @ingroup tables
+19edo carrier phase increment per note
+*/
+
+CONSTTABLE_STORAGE(uint32_t) TUNING_19EDO_DATA [256]  =
+        {
+            66976,69465,72046,74722,77499,80378,83365,86462
+            ,89675,93006,96462,100046,103763,107619,111617,115765
+            ,120066,124527,129154,133952,138929,144091,149445,154998
+            ,160757,166729,172924,179349,186013,192924,200092,207527
+            ,215238,223235,231529,240131,249054,258307,267905,277859
+            ,288182,298890,309995,321513,333459,345849,358699,372026
+            ,385849,400185,415054,430475,446469,463058,480263,498107
+            ,516614,535809,555717,576365,597780,619990,643026,666918
+            ,691697,717397,744052,771697,800370,830108,860950,892939
+            ,926116,960526,996214,1033229,1071618,1111434,1152730,1195559
+            ,1239981,1286052,1333835,1383394,1434794,1488104,1543395,1600739
+            ,1660215,1721900,1785878,1852232,1921052,1992429,2066457,2143237
+            ,2222869,2305459,2391119,2479961,2572104,2667671,2766788,2869588
+            ,2976208,3086789,3201479,3320430,3443801,3571755,3704464,3842104
+            ,3984857,4132915,4286473,4445737,4610919,4782238,4959922,5144208
+            ,5335342,5533576,5739177,5952416,6173578,6402958,6640860,6887601
+            ,7143511,7408928,7684207,7969714,8265829,8572947,8891475,9221838
+            ,9564476,9919844,10288416,10670683,11067153,11478353,11904832,12347157
+            ,12805916,13281720,13775203,14287021,14817856,15368414,15939428,16531659
+            ,17145893,17782949,18443676,19128951,19839688,20576833,21341366,22134305
+            ,22956707,23809664,24694313,25611831,26563440,27550406,28574043,29635712
+            ,30736829,31878857,33063317,34291786,35565899,36887351,38257903,39679377
+            ,41153666,42682732,44268611,45913413,47619328,49388626,51223663,53126880
+            ,55100812,57148085,59271425,61473657,63757713,66126634,34291786,35565899
+            ,36887351,38257903,39679377,41153666,42682732,44268611,45913413,47619328
+            ,49388626,51223663,53126880,55100812,57148085,59271425,61473657,63757713
+            ,66126634,34291786,35565899,36887351,38257903,39679377,41153666,42682732
+            ,44268611,45913413,47619328,49388626,51223663,53126880,55100812,57148085
+            ,59271425,61473657,63757713,66126634,34291786,35565899,36887351,38257903
+            ,39679377,41153666,42682732,44268611,45913413,47619328,49388626,51223663
+            ,53126880,55100812,57148085,59271425,61473657,63757713,66126634,34291786
+            ,35565899,36887351,38257903,39679377,41153666,42682732,44268611,45913413
+        };
+
+// nearest note of the tuning to each equal tempered semitone
+CONSTTABLE_STORAGE(uint8_t) TUNING_19EDO_SEMITONE_STEPS [12]  =
+        {
+            0,2,3,5,6,8,9,11,13,14,16,17
+        };
+
+
+#endif /* TUNING_19EDO_UINT32_H_ */